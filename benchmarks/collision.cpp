@@ -0,0 +1,101 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file collision.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Benchmarks
+#include <fixtures.hpp>
+
+// Core
+#include <core/types.hpp>
+#include <core/board.hpp>
+#include <core/snake.hpp>
+
+// STD
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+//====================================================
+//     nanosecondsPerCheck
+//====================================================
+/**
+ * @brief Function used to time a collision check over a set of query cells.
+ *
+ * @tparam Check The type of the collision check.
+ * @param queries The queried cells (a power of two of them).
+ * @param iterations The number of checks to be timed.
+ * @param check The collision check.
+ * @return double The mean time of a check, in nanoseconds.
+ */
+template <typename Check>
+double nanosecondsPerCheck( const std::vector<snake::core::Cell>& queries, uint64_t iterations, Check check ){
+    uint64_t hits = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for( uint64_t i = 0; i < iterations; i++ ){
+        hits += check( queries[ i & ( queries.size() - 1 ) ] );
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    // Prevent the loop from being optimized away
+    static volatile uint64_t sink;
+    sink = hits;
+
+    return std::chrono::duration<double, std::nano>( stop - start ).count() / iterations;
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    using namespace snake::core;
+
+    // Settings
+    const Board board( 256, 256 );
+    const std::vector<uint32_t> lengths{ 16, 256, 4096, 32768, 65000 };
+    constexpr uint64_t bitmap_iterations{ 20'000'000 };
+    constexpr uint64_t linear_cells{ 400'000'000 };
+
+    // Query cells, both free and covered by the snake
+    std::mt19937 generator( 42 );
+    std::uniform_int_distribution<int32_t> coordinate( 0, board.width - 1 );
+    std::vector<Cell> queries( 1024 );
+    for( auto& query: queries ){
+        query = { coordinate( generator ), coordinate( generator ) };
+    }
+
+    // Run benchmarks
+    std::printf( "%10s %22s %26s\n", "length", "bitmap [ns/check]", "linear scan [ns/check]" );
+    for( const auto length: lengths ){
+        const Snake snake = growSnake( board, length );
+
+        const double bitmap = nanosecondsPerCheck( 
+            queries, bitmap_iterations, 
+            [ &snake ]( const Cell& cell ){ return snake.collides( cell, true ); } 
+        );
+        const double linear = nanosecondsPerCheck( 
+            queries, linear_cells / length + 1, 
+            [ &snake ]( const Cell& cell ){
+                for( uint32_t i = 0; i < snake.length() - 1; i++ ){
+                    if( snake.cell( i ) == cell ){
+                        return true;
+                    }
+                }
+                return false;
+            }
+        );
+
+        std::printf( "%10u %22.2f %26.2f\n", snake.length(), bitmap, linear );
+    }
+}
@@ -0,0 +1,58 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file fixtures.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_BENCHMARKS_FIXTURES
+#define SNAKE_GAME_BENCHMARKS_FIXTURES
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+#include <core/board.hpp>
+#include <core/snake.hpp>
+
+// STD
+#include <cstdint>
+
+//====================================================
+//     growSnake
+//====================================================
+/**
+ * @brief Function used to grow a snake of the requested length along a serpentine path, starting from the top-left corner.
+ *
+ * @param board The board on which the snake moves.
+ * @param length The requested length.
+ * @return snake::core::Snake The grown snake.
+ */
+inline snake::core::Snake growSnake( const snake::core::Board& board, uint32_t length ){
+    using namespace snake::core;
+
+    Snake snake( board, { 0, 0 }, Direction::Right, 1 );
+    while( snake.length() < length ){
+        if( ! board.contains( snake.nextHead() ) ){
+            const bool going_right = snake.direction == Direction::Right;
+            snake.turn( Direction::Down );
+            snake.advance( true );
+            snake.turn( going_right ? Direction::Left : Direction::Right );
+        }
+        else{
+            snake.advance( true );
+        }
+    }
+    return snake;
+}
+
+#endif
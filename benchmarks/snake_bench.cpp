@@ -0,0 +1,267 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file snake_bench.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Benchmarks
+#include <fixtures.hpp>
+
+// Core
+#include <core/types.hpp>
+#include <core/board.hpp>
+#include <core/snake.hpp>
+#include <core/food.hpp>
+#include <core/game.hpp>
+#include <core/random.hpp>
+#include <core/game_files.hpp>
+#include <core/options.hpp>
+#include <core/score_store.hpp>
+
+// STD
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+
+//====================================================
+//     Result
+//====================================================
+/**
+ * @brief Struct used to store the outcome of a benchmark.
+ *
+ */
+struct Result{
+    std::string name;
+    uint64_t iterations;
+    double ns_per_op;
+};
+
+//====================================================
+//     sink
+//====================================================
+/**
+ * @brief Variable used to consume benchmark outputs, so that the timed work is not optimized away.
+ *
+ */
+static volatile uint64_t sink;
+
+//====================================================
+//     run
+//====================================================
+/**
+ * @brief Function used to time a benchmark body. The number of iterations is doubled until a run lasts at least the requested time.
+ *
+ * @tparam Body The type of the benchmark body, called with the number of operations to be run and returning a checksum.
+ * @param name The name of the benchmark.
+ * @param min_seconds The minimum duration of the timed run.
+ * @param body The benchmark body.
+ * @return Result The benchmark outcome.
+ */
+template <typename Body>
+Result run( std::string_view name, double min_seconds, Body body ){
+    for( uint64_t iterations = 1; ; iterations *= 2 ){
+        const auto start = std::chrono::steady_clock::now();
+        sink = body( iterations );
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if( elapsed.count() >= min_seconds || iterations >= ( uint64_t{ 1 } << 40 ) ){
+            return { std::string( name ), iterations, elapsed.count() * 1e9 / iterations };
+        }
+    }
+}
+
+//====================================================
+//     writeJson
+//====================================================
+/**
+ * @brief Function used to write the benchmark results as a JSON document.
+ *
+ * @param output The file to which results are written.
+ * @param results The benchmark results.
+ */
+void writeJson( std::FILE* output, const std::vector<Result>& results ){
+    std::fprintf( output, "{\n  \"benchmarks\": [\n" );
+    for( size_t i = 0; i < results.size(); i++ ){
+        std::fprintf( 
+            output, "    { \"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f }%s\n",
+            results[ i ].name.c_str(), static_cast<unsigned long long>( results[ i ].iterations ), 
+            results[ i ].ns_per_op, i + 1 < results.size() ? "," : ""
+        );
+    }
+    std::fprintf( output, "  ]\n}\n" );
+}
+
+//====================================================
+//     main
+//====================================================
+int main( int argc, char** argv ){
+    using namespace snake::core;
+
+    // Settings: "--out <file>" writes the JSON results to a file instead of the standard output
+    std::string out_path;
+    double min_seconds{ 0.2 };
+    for( int i = 1; i + 1 < argc; i++ ){
+        if( std::string_view( argv[ i ] ) == "--out" ){
+            out_path = argv[ i + 1 ];
+        }
+        else if( std::string_view( argv[ i ] ) == "--min-time" ){
+            min_seconds = std::stod( argv[ i + 1 ] );
+        }
+    }
+    const Board board( 64, 48 );
+    std::vector<Result> results;
+
+    // Snake tick: a whole game step, turning around a loop so that the snake never dies
+    results.push_back( run( "game_tick", min_seconds, [ &board ]( uint64_t n ){
+        Game game( board, 1 );
+        const Input loop[]{ Input::Left, Input::Down, Input::Right, Input::Up };
+        for( uint64_t i = 0; i < n; i++ ){
+            if( ! game.alive ){
+                game = Game( board, i );
+            }
+            game.step( i % 8 == 0 ? loop[ ( i / 8 ) % 4 ] : Input::None );
+        }
+        return game.ticks;
+    } ) );
+
+    // Body growth: advance and grow up to the whole board, then start again
+    results.push_back( run( "snake_growth", min_seconds, [ &board ]( uint64_t n ){
+        uint64_t checksum = 0;
+        for( uint64_t done = 0; done < n; ){
+            const uint32_t length = static_cast<uint32_t>( std::min<uint64_t>( n - done, board.size() - 1 ) );
+            checksum += growSnake( board, length + 1 ).length();
+            done += length;
+        }
+        return checksum;
+    } ) );
+
+    // Collision checks against a long snake
+    {
+        const Snake snake = growSnake( board, board.size() / 2 );
+        Random random( 7 );
+        std::vector<Cell> queries( 1024 );
+        for( auto& query: queries ){
+            query = board.cell( random.uniform( board.size() ) );
+        }
+        results.push_back( run( "collision_check", min_seconds, [ &snake, &queries ]( uint64_t n ){
+            uint64_t hits = 0;
+            for( uint64_t i = 0; i < n; i++ ){
+                hits += snake.collides( queries[ i & ( queries.size() - 1 ) ], true );
+            }
+            return hits;
+        } ) );
+    }
+
+    // Food respawn with half of the board covered
+    {
+        const Snake snake = growSnake( board, board.size() / 2 );
+        results.push_back( run( "food_respawn", min_seconds, [ &snake ]( uint64_t n ){
+            Random random( 11 );
+            Food food( snake.occupied(), random );
+            uint64_t checksum = 0;
+            for( uint64_t i = 0; i < n; i++ ){
+                food.respawn( snake.occupied(), random );
+                checksum += static_cast<uint64_t>( food.position.x );
+            }
+            return checksum;
+        } ) );
+    }
+
+    // Game files, written to a temporary directory
+    const auto directory = std::filesystem::temp_directory_path() / "snake-bench";
+    std::filesystem::create_directories( directory );
+    const auto options_path = directory / "snake-game_options.txt";
+    const auto score_path = directory / "snake-game_score.txt";
+    std::ofstream( options_path ) << "Player: Bench\nSpeedPlus: 25\nBackground: default\nSeed: random\n";
+    {
+        std::ofstream score_file( score_path );
+        Random random( 3 );
+        for( uint32_t i = 0; i < 1000; i++ ){
+            score_file << random.uniform( 500 ) << " player" << i % 10 << "\n";
+        }
+    }
+
+    // Options parsing, done once by GameWindow
+    results.push_back( run( "options_parsing", min_seconds, [ &options_path ]( uint64_t n ){
+        uint64_t checksum = 0;
+        for( uint64_t i = 0; i < n; i++ ){
+            std::ifstream input( options_path );
+            checksum += static_cast<uint64_t>( Options::parse( input ).speed );
+        }
+        return checksum;
+    } ) );
+
+    // Import of the text score file written by older versions, done once by GameWindow::openScoreStore (1000 rows)
+    const auto import_path = directory / "snake-game_scores_import.bin";
+    results.push_back( run( "legacy_score_import_1000", min_seconds, [ &score_path, &import_path ]( uint64_t n ){
+        uint64_t checksum = 0;
+        for( uint64_t i = 0; i < n; i++ ){
+            std::filesystem::remove( import_path );
+            ScoreStore store;
+            store.open( import_path );
+            std::ifstream input( score_path );
+            store.append( readScores( input ) );
+            checksum += store.size();
+        }
+        return checksum;
+    } ) );
+
+    // Score store opening, as done by GameWindow, with a long history (100000 games)
+    const auto store_path = directory / "snake-game_scores.bin";
+    {
+        std::vector<ScoreEntry> entries;
+        Random random( 4 );
+        for( uint32_t i = 0; i < 100000; i++ ){
+            entries.push_back( { random.uniform( 500 ), "player" + std::to_string( i % 10 ) } );
+        }
+        ScoreStore store;
+        store.open( store_path );
+        store.append( entries );
+    }
+    results.push_back( run( "score_store_open_100000", min_seconds, [ &store_path ]( uint64_t n ){
+        uint64_t checksum = 0;
+        for( uint64_t i = 0; i < n; i++ ){
+            ScoreStore store;
+            store.open( store_path );
+            checksum += store.best() + store.top().size();
+        }
+        return checksum;
+    } ) );
+
+    // Score store append, as done at game over
+    results.push_back( run( "score_store_append", min_seconds, [ &store_path ]( uint64_t n ){
+        ScoreStore store;
+        store.open( store_path );
+        for( uint64_t i = 0; i < n; i++ ){
+            store.append( { i % 500, "bench" } );
+        }
+        return store.size();
+    } ) );
+    std::filesystem::remove_all( directory );
+
+    // Write results
+    if( out_path.empty() ){
+        writeJson( stdout, results );
+    }
+    else if( std::FILE* output = std::fopen( out_path.c_str(), "w" ) ){
+        writeJson( output, results );
+        std::fclose( output );
+    }
+    else{
+        std::fprintf( stderr, "Cannot write to %s\n", out_path.c_str() );
+        return 1;
+    }
+}
@@ -0,0 +1,88 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file asset_archive.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_ASSET_ARCHIVE
+#define SNAKE_GAME_CORE_ASSET_ARCHIVE
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     AssetArchive
+    //====================================================
+    /**
+     * @brief Class used to read the assets packed into a single indexed file. The archive is memory mapped, so the returned file contents point straight into it and stay valid until the archive is closed.
+     *
+     */
+    class AssetArchive{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            AssetArchive() = default;
+
+            // Destructor
+            ~AssetArchive();
+
+            // Methods
+            bool open( const std::filesystem::path& path );
+            void close();
+            std::optional<std::string_view> find( const std::string& path ) const;
+            static uint64_t pack( const std::filesystem::path& archive_path, const std::filesystem::path& root, const std::vector<std::filesystem::path>& directories );
+            static std::filesystem::path defaultPath( const char* argv0 );
+
+            // Getters
+            size_t size() const;
+
+            // Operators
+            AssetArchive( const AssetArchive& ) = delete;
+            AssetArchive& operator=( const AssetArchive& ) = delete;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Methods
+            bool readIndex();
+
+            // Variables
+            const char* data{ nullptr };
+            size_t data_size{ 0 };
+            void* mapping{ nullptr };
+            std::unordered_map<std::string, std::string_view> entries;
+
+            // Constants
+            static constexpr char magic[4]{ 'S', 'N', 'K', 'A' };
+            static constexpr uint8_t version{ 1 };
+    };
+}
+
+#endif
@@ -0,0 +1,63 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file batch.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_BATCH
+#define SNAKE_GAME_CORE_BATCH
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/board.hpp>
+
+// STD
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     BatchStats
+    //====================================================
+    /**
+     * @brief Struct used to aggregate the outcome of a batch of games.
+     *
+     */
+    struct BatchStats{
+
+        // Methods
+        void add( uint64_t score, uint64_t length, uint64_t ticks, bool won );
+        void merge( const BatchStats& other );
+
+        // Getters
+        double meanScore() const;
+        double meanLength() const;
+        double ticksPerSecond() const;
+
+        // Variables
+        uint64_t games{ 0 };
+        uint64_t wins{ 0 };
+        uint64_t total_score{ 0 };
+        uint64_t max_score{ 0 };
+        uint64_t total_length{ 0 };
+        uint64_t max_length{ 0 };
+        uint64_t total_ticks{ 0 };
+        double seconds{ 0.0 };
+    };
+
+    // Functions
+    BatchStats runBatch( const Board& board, uint64_t games, uint64_t first_seed, uint32_t threads, uint64_t max_ticks );
+}
+
+#endif
@@ -0,0 +1,63 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file binary_io.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_BINARY_IO
+#define SNAKE_GAME_CORE_BINARY_IO
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <cstdint>
+#include <ostream>
+
+namespace snake::core{
+
+    //====================================================
+    //     writeInteger
+    //====================================================
+    /**
+     * @brief Function used to write an unsigned integer in little endian order, so that game files do not depend on the platform.
+     *
+     * @param output The stream to which the integer is written.
+     * @param value The integer.
+     * @param bytes The number of bytes to be written.
+     */
+    inline void writeInteger( std::ostream& output, uint64_t value, uint32_t bytes ){
+        for( uint32_t byte = 0; byte < bytes; ++byte ){
+            output.put( static_cast<char>( value >> ( 8 * byte ) ) );
+        }
+    }
+
+    //====================================================
+    //     readInteger
+    //====================================================
+    /**
+     * @brief Function used to read an unsigned integer stored in little endian order.
+     *
+     * @param data The first byte of the integer.
+     * @param bytes The number of bytes to be read.
+     * @return uint64_t The integer.
+     */
+    inline uint64_t readInteger( const char* data, uint32_t bytes ){
+        uint64_t value = 0;
+        for( uint32_t byte = 0; byte < bytes; ++byte ){
+            value |= static_cast<uint64_t>( static_cast<uint8_t>( data[ byte ] ) ) << ( 8 * byte );
+        }
+        return value;
+    }
+}
+
+#endif
@@ -0,0 +1,62 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file board.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_BOARD
+#define SNAKE_GAME_CORE_BOARD
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+
+// STD
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     Board
+    //====================================================
+    /**
+     * @brief Class used to describe the grid on which the game is played.
+     *
+     */
+    class Board{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            Board( int32_t width, int32_t height );
+
+            // Methods
+            bool contains( const Cell& cell ) const;
+            uint32_t index( const Cell& cell ) const;
+            Cell cell( uint32_t index ) const;
+            uint32_t size() const;
+
+            // Variables
+            int32_t width;
+            int32_t height;
+
+            // Constants
+            static constexpr int32_t min_size{ 4 };
+    };
+}
+
+#endif
@@ -0,0 +1,32 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file bot.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_BOT
+#define SNAKE_GAME_CORE_BOT
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+#include <core/game.hpp>
+
+namespace snake::core{
+
+    // Functions
+    Input greedyInput( const Game& game );
+}
+
+#endif
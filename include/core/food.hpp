@@ -0,0 +1,54 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file food.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_FOOD
+#define SNAKE_GAME_CORE_FOOD
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+#include <core/occupancy.hpp>
+#include <core/random.hpp>
+
+namespace snake::core{
+
+    //====================================================
+    //     Food
+    //====================================================
+    /**
+     * @brief Class used to store the food state on the board grid.
+     *
+     */
+    class Food{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            Food( const Occupancy& occupancy, Random& random );
+
+            // Methods
+            bool respawn( const Occupancy& occupancy, Random& random );
+
+            // Variables
+            Cell position;
+    };
+}
+
+#endif
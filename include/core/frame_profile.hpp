@@ -0,0 +1,91 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file frame_profile.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_FRAME_PROFILE
+#define SNAKE_GAME_CORE_FRAME_PROFILE
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     Phase
+    //====================================================
+    /**
+     * @brief Enum used to identify the timed phases of a game frame. The input latency is the time a turn waits before being consumed by a tick.
+     *
+     */
+    enum class Phase: uint8_t{
+        UpdateEntities = 0,
+        GameRules,
+        PackWidgets,
+        DrawEntities,
+        Display,
+        InputLatency
+    };
+
+    //====================================================
+    //     FrameProfile
+    //====================================================
+    /**
+     * @brief Class used to collect the frame times of the last frames and a smoothed duration of each frame phase. Each phase may be timed by a different thread, while frames are added and read by the thread which draws them.
+     *
+     */
+    class FrameProfile{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Methods
+            void addPhase( Phase phase, double seconds );
+            void addFrame( double seconds );
+
+            // Getters
+            double phase( Phase phase ) const;
+            double frameTime( uint32_t age ) const;
+            double meanFrameTime() const;
+            double maxFrameTime() const;
+            uint32_t frames() const;
+
+            // Static methods
+            static const char* phaseName( Phase phase );
+
+            // Constants
+            static constexpr uint32_t history_size{ 120 };
+            static constexpr uint32_t phase_count{ 6 };
+            static constexpr double smoothing{ 0.1 };
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Variables
+            std::array<std::atomic<double>, phase_count> phases{};
+            std::array<double, history_size> history{};
+            uint32_t next{ 0 };
+            uint32_t count{ 0 };
+    };
+}
+
+#endif
@@ -0,0 +1,82 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file game.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_GAME
+#define SNAKE_GAME_CORE_GAME
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+#include <core/board.hpp>
+#include <core/snake.hpp>
+#include <core/food.hpp>
+#include <core/random.hpp>
+
+// STD
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     StepResult
+    //====================================================
+    /**
+     * @brief Struct used to report what happened during a simulation step.
+     *
+     */
+    struct StepResult{
+        bool ate_food{ false };
+        bool died{ false };
+        bool won{ false };
+    };
+
+    //====================================================
+    //     Game
+    //====================================================
+    /**
+     * @brief Class used to run the game rules, without any dependency on graphics or windows.
+     *
+     */
+    class Game{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            Game( const Board& board, uint64_t seed );
+
+            // Methods
+            StepResult step( Input input );
+
+            // Variables
+            uint64_t seed;
+            Board board;
+            Random random;
+            Snake snake;
+            Food food;
+            uint64_t score{ 0 };
+            uint64_t ticks{ 0 };
+            bool alive{ true };
+
+            // Constants
+            static constexpr uint32_t start_length{ 2 };
+    };
+}
+
+#endif
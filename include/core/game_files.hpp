@@ -0,0 +1,54 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file game_files.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_GAME_FILES
+#define SNAKE_GAME_CORE_GAME_FILES
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <istream>
+#include <filesystem>
+
+namespace snake::core{
+
+    //====================================================
+    //     ScoreEntry
+    //====================================================
+    /**
+     * @brief Struct used to store a row of the scores file.
+     *
+     */
+    struct ScoreEntry{
+        uint64_t score;
+        std::string player;
+    };
+
+    // Functions
+    std::vector<ScoreEntry> readScores( std::istream& input );
+    bool writeFileAtomically( const std::filesystem::path& path, std::string_view content );
+    bool moveAside( const std::filesystem::path& path );
+    std::string_view truncateUtf8( std::string_view text, size_t size );
+    std::filesystem::path replayPath( const std::filesystem::path& directory, uint64_t index );
+    uint64_t nextReplayIndex( const std::filesystem::path& directory );
+}
+
+#endif
@@ -0,0 +1,82 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file input_queue.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_INPUT_QUEUE
+#define SNAKE_GAME_CORE_INPUT_QUEUE
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+
+// STD
+#include <array>
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     InputQueue
+    //====================================================
+    /**
+     * @brief Class used to buffer the turns pressed between two simulation ticks, so that each tick consumes at most one of them.
+     *
+     */
+    class InputQueue{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Methods
+            bool push( Input input, Direction heading, double time );
+            Input pop( double time );
+            void clear();
+
+            // Getters
+            uint32_t size() const;
+            uint64_t latencySamples() const;
+            double lastLatency() const;
+            double meanLatency() const;
+            double maxLatency() const;
+
+            // Constants
+            static constexpr uint32_t capacity{ 3 };
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Structs
+            struct Entry{
+                Input input;
+                double time;
+            };
+
+            // Variables
+            std::array<Entry, capacity> entries{};
+            uint32_t front{ 0 };
+            uint32_t count{ 0 };
+            uint64_t latency_samples{ 0 };
+            double latency_total{ 0.0 };
+            double latency_max{ 0.0 };
+            double latency_last{ 0.0 };
+    };
+}
+
+#endif
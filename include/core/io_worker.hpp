@@ -0,0 +1,80 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file io_worker.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_IO_WORKER
+#define SNAKE_GAME_CORE_IO_WORKER
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace snake::core{
+
+    //====================================================
+    //     IoWorker
+    //====================================================
+    /**
+     * @brief Class used to run file writes on a thread of their own, in the order they are posted, so that slow disks never stall a frame. The queue is bounded: posting to a full queue waits for room. Pending writes are finished when the worker is flushed or destroyed.
+     *
+     */
+    class IoWorker{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            explicit IoWorker( size_t capacity = 16 );
+
+            // Destructor
+            ~IoWorker();
+
+            // Methods
+            void post( std::function<void()> task );
+            void flush();
+
+            // Operators
+            IoWorker( const IoWorker& ) = delete;
+            IoWorker& operator=( const IoWorker& ) = delete;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Methods
+            void run();
+
+            // Variables
+            size_t capacity;
+            std::deque<std::function<void()>> tasks;
+            bool busy{ false };
+            bool stopping{ false };
+            std::mutex mutex;
+            std::condition_variable task_posted;
+            std::condition_variable task_done;
+            std::thread thread;
+    };
+}
+
+#endif
@@ -0,0 +1,77 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file occupancy.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_OCCUPANCY
+#define SNAKE_GAME_CORE_OCCUPANCY
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+#include <core/board.hpp>
+
+// STD
+#include <cstdint>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     Occupancy
+    //====================================================
+    /**
+     * @brief Class used to store a bitset of the blocked cells of the board. The board is padded with a one cell border whose bits are always set, so that walls and body are found by the same lookup. The free board cells are also kept in an indexable set (dense array plus reverse index), so a free cell can be drawn uniformly in O(1) whatever the fill ratio.
+     *
+     */
+    class Occupancy{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            Occupancy( const Board& board );
+
+            // Methods
+            void set( const Cell& cell );
+            void reset( const Cell& cell );
+            bool test( const Cell& cell ) const;
+
+            // Getters
+            uint32_t freeCount() const;
+            Cell freeCell( uint32_t index ) const;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Methods
+            uint32_t slot( const Cell& cell ) const;
+            void setBit( uint32_t index );
+            void resetBit( uint32_t index );
+
+            // Variables
+            Board board;
+            int32_t padded_width;
+            std::vector<uint64_t> words;
+            std::vector<uint32_t> free_cells;
+            std::vector<uint32_t> free_positions;
+    };
+}
+
+#endif
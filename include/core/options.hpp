@@ -0,0 +1,59 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file options.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_OPTIONS
+#define SNAKE_GAME_CORE_OPTIONS
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <istream>
+#include <ostream>
+
+namespace snake::core{
+
+    //====================================================
+    //     Options
+    //====================================================
+    /**
+     * @brief Struct used to store the game options, parsed once from the options file. Each row of the file holds a key and a value (e.g. "SpeedPlus: 25"); missing or invalid values keep their defaults.
+     *
+     */
+    struct Options{
+
+        // Methods
+        static Options parse( std::istream& input );
+        void write( std::ostream& output ) const;
+        bool save( const std::filesystem::path& path ) const;
+        bool setPlayer( std::string_view value );
+        bool setSpeed( std::string_view value );
+        bool setBackground( std::string_view value );
+        bool setSeed( std::string_view value );
+
+        // Variables
+        std::string player{ "Unknown" };
+        int32_t speed{ 25 };
+        std::string background{ "default" };
+        std::optional<uint64_t> seed;
+    };
+}
+
+#endif
@@ -0,0 +1,59 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file random.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_RANDOM
+#define SNAKE_GAME_CORE_RANDOM
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <array>
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     Random
+    //====================================================
+    /**
+     * @brief Class used to generate random numbers for a game session (xoshiro256** engine). The same seed always gives the same sequence, on every platform.
+     *
+     */
+    class Random{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            Random( uint64_t seed );
+
+            // Methods
+            uint64_t next();
+            uint32_t uniform( uint32_t bound );
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Variables
+            std::array<uint64_t, 4> state;
+    };
+}
+
+#endif
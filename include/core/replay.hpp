@@ -0,0 +1,90 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file replay.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_REPLAY
+#define SNAKE_GAME_CORE_REPLAY
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+#include <core/board.hpp>
+
+// STD
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <istream>
+#include <ostream>
+
+namespace snake::core{
+
+    //====================================================
+    //     Replay
+    //====================================================
+    /**
+     * @brief Class used to record a game as its seed plus the ticks at which the direction has been changed, and to feed them back to a new game.
+     *
+     */
+    class Replay{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            Replay( const Board& board, uint64_t seed );
+
+            // Methods
+            void record( uint64_t tick, Input input );
+            Input next( uint64_t tick );
+            void save( std::ostream& output ) const;
+            static Replay load( std::istream& input );
+
+            // Getters
+            size_t size() const;
+
+            // Variables
+            Board board;
+            uint64_t seed;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Structs
+            struct Event{
+                uint64_t tick;
+                Input input;
+            };
+
+            // Methods
+            static void writeVarint( std::ostream& output, uint64_t value );
+            static uint64_t readVarint( std::istream& input );
+
+            // Variables
+            std::vector<Event> events;
+            size_t cursor{ 0 };
+
+            // Constants
+            static constexpr char magic[4]{ 'S', 'N', 'K', 'R' };
+            static constexpr uint8_t version{ 1 };
+    };
+}
+
+#endif
@@ -0,0 +1,94 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file score_store.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_SCORE_STORE
+#define SNAKE_GAME_CORE_SCORE_STORE
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/game_files.hpp>
+
+// STD
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     ScoreStore
+    //====================================================
+    /**
+     * @brief Class used to store every played game in a binary file of fixed size records. The file header keeps the number of games, the best score and the best games, updated on each append, so that opening the store costs the same however long the history is.
+     *
+     */
+    class ScoreStore{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            ScoreStore() = default;
+
+            // Methods
+            bool open( const std::filesystem::path& path );
+            bool append( const ScoreEntry& entry );
+            bool append( const std::vector<ScoreEntry>& entries );
+
+            // Getters
+            const std::vector<ScoreEntry>& top() const;
+            uint64_t best() const;
+            uint64_t size() const;
+
+            // Constants
+            static constexpr uint32_t top_capacity{ 10 };
+            static constexpr uint32_t player_size{ 32 };
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Methods
+            void insertTop( const ScoreEntry& entry );
+            bool readHeader( const char* header );
+            static bool isStore( const char* header );
+            void writeHeader( std::ostream& output ) const;
+            bool rebuild( uint64_t records );
+            static void writeRecord( std::ostream& output, const ScoreEntry& entry );
+            static ScoreEntry readRecord( const char* data );
+
+            // Variables
+            std::filesystem::path file_path;
+            uint64_t count{ 0 };
+            uint64_t best_score{ 0 };
+            std::vector<ScoreEntry> top_scores;
+
+            // Constants
+            static constexpr char magic[4]{ 'S', 'N', 'K', 'S' };
+            static constexpr uint8_t version{ 1 };
+            static constexpr size_t record_size{ 8 + player_size };
+            static constexpr size_t header_size{ sizeof( magic ) + 4 + 8 + 8 + 8 + top_capacity * record_size };
+    };
+}
+
+#endif
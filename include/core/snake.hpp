@@ -0,0 +1,84 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file snake.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_SNAKE
+#define SNAKE_GAME_CORE_SNAKE
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+#include <core/board.hpp>
+#include <core/occupancy.hpp>
+
+// STD
+#include <cstdint>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     Snake
+    //====================================================
+    /**
+     * @brief Class used to store the snake state on the board grid. The first cell is the head. Cells are kept in a fixed-capacity ring buffer, so a movement is one head push and (unless growing) one tail pop, whatever the snake length. The covered cells are also mirrored in an occupancy bitset, so collisions are a single bit lookup.
+     *
+     */
+    class Snake{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            Snake( const Board& board, const Cell& head, Direction direction, uint32_t length );
+
+            // Methods
+            void turn( Direction new_direction );
+            void advance( bool grow );
+            bool collides( const Cell& cell, bool ignore_tail ) const;
+            Cell nextHead() const;
+
+            // Getters
+            const Cell& head() const;
+            const Cell& tail() const;
+            const Cell& cell( uint32_t index ) const;
+            const Occupancy& occupied() const;
+            uint32_t length() const;
+            uint32_t capacity() const;
+            uint64_t moves() const;
+
+            // Variables
+            Direction direction;
+            Direction last_direction;
+            Cell previous_tail;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Variables
+            Occupancy occupancy;
+            std::vector<Cell> ring;
+            uint32_t head_index{ 0 };
+            uint32_t body_length{ 0 };
+            uint64_t move_count{ 0 };
+    };
+}
+
+#endif
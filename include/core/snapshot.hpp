@@ -0,0 +1,222 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file snapshot.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_SNAPSHOT
+#define SNAKE_GAME_CORE_SNAPSHOT
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+#include <core/snake.hpp>
+#include <core/game.hpp>
+
+// STD
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     SnakeView
+    //====================================================
+    /**
+     * @brief Class used to hold the snake cells needed to draw it. It is kept in step with a snake by copying only the cells entered since the last capture, so that a capture costs as many cells as the snake moved, not the whole board.
+     *
+     */
+    class SnakeView{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            explicit SnakeView( const Snake& snake );
+
+            // Methods
+            void capture( const Snake& snake );
+
+            // Getters
+            const Cell& head() const;
+            const Cell& tail() const;
+            const Cell& cell( uint32_t index ) const;
+            uint32_t length() const;
+            uint32_t capacity() const;
+            uint64_t moves() const;
+
+            // Variables
+            Direction last_direction;
+            Cell previous_tail;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Variables
+            std::vector<Cell> ring;
+            uint32_t head_index{ 0 };
+            uint32_t body_length{ 0 };
+            uint64_t move_count{ 0 };
+    };
+
+    //====================================================
+    //     Snapshot
+    //====================================================
+    /**
+     * @brief Struct used to hold a copy of everything needed to draw a game after a simulation tick, so that it can be read by another thread while the game goes on.
+     *
+     */
+    struct Snapshot{
+
+        // Constructors
+        explicit Snapshot( const Game& game );
+
+        // Methods
+        void capture( const Game& game, double tick_time );
+
+        // Variables
+        SnakeView snake;
+        Cell food;
+        uint64_t score;
+        uint64_t ticks;
+        bool alive;
+        double time{ 0.0 };
+    };
+
+    //====================================================
+    //     SnapshotBuffer
+    //====================================================
+    /**
+     * @brief Class used to hand snapshots from one producer thread to one consumer thread without locks. Three slots are used: the producer fills its own back slot and swaps it with the middle one, the consumer swaps its front slot with the middle one when a newer snapshot is there; neither side ever waits for the other, and the slot being read is never written.
+     *
+     * @tparam T The snapshot type.
+     */
+    template <typename T>
+    class SnapshotBuffer{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            explicit SnapshotBuffer( const T& initial );
+
+            // Methods
+            T& back();
+            void publish();
+            bool acquire();
+
+            // Getters
+            const T& front() const;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Variables
+            std::array<T, 3> slots;
+            std::atomic<uint8_t> middle{ 1 };
+            uint8_t back_index{ 0 };
+            uint8_t front_index{ 2 };
+
+            // Constants
+            static constexpr uint8_t fresh_bit{ 4 };
+            static constexpr uint8_t index_mask{ 3 };
+    };
+
+    //====================================================
+    //     SnapshotBuffer (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the SnapshotBuffer class.
+     *
+     * @tparam T The snapshot type.
+     * @param initial The snapshot read by the consumer until the first one is published.
+     */
+    template <typename T>
+    SnapshotBuffer<T>::SnapshotBuffer( const T& initial ):
+        slots{ initial, initial, initial }{
+
+    }
+
+    //====================================================
+    //     back
+    //====================================================
+    /**
+     * @brief Method used by the producer to get the slot to be filled with the next snapshot.
+     *
+     * @tparam T The snapshot type.
+     * @return T& The producer slot.
+     */
+    template <typename T>
+    T& SnapshotBuffer<T>::back(){
+        return this -> slots[ this -> back_index ];
+    }
+
+    //====================================================
+    //     publish
+    //====================================================
+    /**
+     * @brief Method used by the producer to make the filled back slot the newest snapshot. A snapshot not yet acquired is replaced.
+     *
+     * @tparam T The snapshot type.
+     */
+    template <typename T>
+    void SnapshotBuffer<T>::publish(){
+        this -> back_index = this -> middle.exchange( this -> back_index | fresh_bit, std::memory_order_acq_rel ) & index_mask;
+    }
+
+    //====================================================
+    //     acquire
+    //====================================================
+    /**
+     * @brief Method used by the consumer to move to the newest published snapshot, if any.
+     *
+     * @tparam T The snapshot type.
+     * @return true If a newer snapshot is now the front one.
+     * @return false If nothing has been published since the last call.
+     */
+    template <typename T>
+    bool SnapshotBuffer<T>::acquire(){
+        if( ( this -> middle.load( std::memory_order_relaxed ) & fresh_bit ) == 0 ){
+            return false;
+        }
+        this -> front_index = this -> middle.exchange( this -> front_index, std::memory_order_acq_rel ) & index_mask;
+        return true;
+    }
+
+    //====================================================
+    //     front
+    //====================================================
+    /**
+     * @brief Getter used by the consumer to read the last acquired snapshot. It stays untouched until the next acquire.
+     *
+     * @tparam T The snapshot type.
+     * @return const T& The consumer slot.
+     */
+    template <typename T>
+    const T& SnapshotBuffer<T>::front() const {
+        return this -> slots[ this -> front_index ];
+    }
+}
+
+#endif
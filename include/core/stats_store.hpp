@@ -0,0 +1,130 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file stats_store.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_STATS_STORE
+#define SNAKE_GAME_CORE_STATS_STORE
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/score_store.hpp>
+
+// STD
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     GameStats
+    //====================================================
+    /**
+     * @brief Struct used to describe a finished game, as added to the statistics of its player. The play time is in milliseconds.
+     *
+     */
+    struct GameStats{
+        std::string player;
+        uint64_t score{ 0 };
+        uint64_t food{ 0 };
+        uint64_t play_time{ 0 };
+    };
+
+    //====================================================
+    //     PlayerStats
+    //====================================================
+    /**
+     * @brief Struct used to store the statistics of a player. Totals are kept instead of the games themselves, so that every statistic is read in constant time.
+     *
+     */
+    struct PlayerStats{
+
+        // Constants
+        static constexpr uint32_t recent_capacity{ 5 };
+
+        // Methods
+        void add( const GameStats& game );
+        double mean() const;
+        std::vector<uint64_t> recent() const;
+
+        // Variables
+        std::string player;
+        uint64_t games{ 0 };
+        uint64_t best{ 0 };
+        uint64_t total_score{ 0 };
+        uint64_t food{ 0 };
+        uint64_t play_time{ 0 };
+        std::array<uint64_t, recent_capacity> recent_scores{};
+    };
+
+    //====================================================
+    //     StatsStore
+    //====================================================
+    /**
+     * @brief Class used to store the statistics of each player in a binary file with a fixed size record per player. The file is rewritten atomically on each game, which costs the same however many games have been played.
+     *
+     */
+    class StatsStore{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            StatsStore() = default;
+
+            // Methods
+            bool open( const std::filesystem::path& path );
+            bool add( const GameStats& game );
+
+            // Getters
+            const PlayerStats* find( const std::string& player ) const;
+            const std::unordered_map<std::string, PlayerStats>& players() const;
+
+            // Constants
+            static constexpr uint32_t player_size{ ScoreStore::player_size };
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Methods
+            bool save() const;
+            static bool isStore( std::string_view data );
+            static void writeRecord( std::ostream& output, const PlayerStats& stats );
+            static PlayerStats readRecord( const char* data );
+
+            // Variables
+            std::filesystem::path file_path;
+            std::unordered_map<std::string, PlayerStats> player_stats;
+
+            // Constants
+            static constexpr char magic[4]{ 'S', 'N', 'K', 'P' };
+            static constexpr uint8_t version{ 1 };
+            static constexpr size_t header_size{ sizeof( magic ) + 4 + 8 };
+            static constexpr size_t record_size{ player_size + 5 * 8 + PlayerStats::recent_capacity * 8 };
+    };
+}
+
+#endif
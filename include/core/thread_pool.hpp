@@ -0,0 +1,96 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file thread_pool.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_THREAD_POOL
+#define SNAKE_GAME_CORE_THREAD_POOL
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     WorkStealingPool
+    //====================================================
+    /**
+     * @brief Class used to run batches of independent tasks on several threads, which live as long as the pool. Each worker owns a queue of tasks and, once it is empty, steals from the other workers.
+     *
+     */
+    class WorkStealingPool{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            WorkStealingPool( uint32_t threads );
+
+            // Destructor
+            ~WorkStealingPool();
+
+            // Methods
+            void post( uint64_t tasks, std::function<void( uint32_t, uint64_t )> job );
+            void wait();
+            void run( uint64_t tasks, std::function<void( uint32_t, uint64_t )> job );
+
+            // Getters
+            uint32_t size() const;
+
+            // Operators
+            WorkStealingPool( const WorkStealingPool& ) = delete;
+            WorkStealingPool& operator=( const WorkStealingPool& ) = delete;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Structs
+            struct alignas( 64 ) Queue{
+                std::mutex mutex;
+                std::deque<uint64_t> tasks;
+            };
+
+            // Methods
+            bool pop( uint32_t worker, uint64_t& task );
+            bool steal( uint32_t thief, uint64_t& task );
+            void work( uint32_t worker );
+
+            // Variables
+            uint32_t threads;
+            std::vector<Queue> queues;
+            std::function<void( uint32_t, uint64_t )> job;
+            std::atomic<uint64_t> remaining{ 0 };
+            uint64_t batch{ 0 };
+            bool stopping{ false };
+            std::mutex mutex;
+            std::condition_variable batch_posted;
+            std::condition_variable batch_done;
+            std::vector<std::thread> workers;
+    };
+}
+
+#endif
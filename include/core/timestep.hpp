@@ -0,0 +1,66 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file timestep.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_TIMESTEP
+#define SNAKE_GAME_CORE_TIMESTEP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     FixedTimestep
+    //====================================================
+    /**
+     * @brief Class used to convert the variable frame time into a fixed number of simulation ticks.
+     *
+     */
+    class FixedTimestep{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            FixedTimestep( double ticks_per_second );
+
+            // Methods
+            uint32_t advance( double elapsed_seconds );
+            void reset();
+
+            // Getters
+            double alpha() const;
+            double tickDuration() const;
+
+            // Constants
+            static constexpr uint32_t max_ticks_per_frame{ 5 };
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Variables
+            double tick_duration;
+            double accumulator{ 0.0 };
+    };
+}
+
+#endif
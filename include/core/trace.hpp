@@ -0,0 +1,147 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file trace.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_TRACE
+#define SNAKE_GAME_CORE_TRACE
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+//====================================================
+//     Trace macros
+//====================================================
+
+// Scoped markers exist only in builds configured with SNAKE_GAME_TRACE
+#ifdef SNAKE_GAME_TRACE
+    #define SNAKE_TRACE_CONCAT_IMPL( a, b ) a##b
+    #define SNAKE_TRACE_CONCAT( a, b ) SNAKE_TRACE_CONCAT_IMPL( a, b )
+    #define SNAKE_TRACE_SCOPE( ... ) const snake::core::TraceScope SNAKE_TRACE_CONCAT( trace_scope_, __COUNTER__ ){ __VA_ARGS__ }
+    #define SNAKE_TRACE_THREAD( name ) snake::core::Trace::threadName( name )
+#else
+    #define SNAKE_TRACE_SCOPE( ... )
+    #define SNAKE_TRACE_THREAD( name )
+#endif
+
+namespace snake::core{
+
+    //====================================================
+    //     Trace
+    //====================================================
+    /**
+     * @brief Class used to collect timed events from any thread and to write them as a Chrome trace JSON file, which can be opened in chrome://tracing or Perfetto. Nothing is collected until the trace is started. Each thread appends to a buffer of its own, and buffers are merged when the file is written; past max_events, events are counted as dropped instead.
+     *
+     */
+    class Trace{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Static methods
+            static void start( const std::filesystem::path& path );
+            static bool stop();
+            static bool active();
+            static void threadName( const char* name );
+            static void record( const char* name, std::string detail, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end );
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Structs
+            struct Event{
+                const char* name;
+                std::string detail;
+                int64_t begin;
+                int64_t duration;
+            };
+            struct Buffer{
+                std::mutex mutex;
+                uint32_t thread;
+                std::vector<Event> events;
+            };
+
+            // Static methods
+            static uint32_t threadId();
+            static Buffer& threadBuffer();
+            static int64_t microseconds( std::chrono::steady_clock::time_point time );
+            static std::string escape( const std::string& text );
+
+            // Static variables
+            static std::atomic<bool> enabled;
+            static std::mutex mutex;
+            static std::vector<std::shared_ptr<Buffer>> buffers;
+            static std::atomic<uint64_t> event_count;
+            static std::atomic<uint64_t> dropped_events;
+            static std::vector<std::pair<uint32_t, const char*>> thread_names;
+            static std::filesystem::path file_path;
+            static std::chrono::steady_clock::time_point origin;
+
+            // Constants
+            static constexpr uint64_t max_events{ 1000000 };
+    };
+
+    //====================================================
+    //     TraceScope
+    //====================================================
+    /**
+     * @brief Class used to record the lifetime of a scope as a trace event. It is meant to be created through the SNAKE_TRACE_SCOPE macro.
+     *
+     */
+    class TraceScope{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            explicit TraceScope( const char* name, std::string_view detail = {} );
+
+            // Destructor
+            ~TraceScope();
+
+            // Operators
+            TraceScope( const TraceScope& ) = delete;
+            TraceScope& operator=( const TraceScope& ) = delete;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Variables
+            const char* name;
+            std::string detail;
+            bool recording;
+            std::chrono::steady_clock::time_point begin;
+    };
+}
+
+#endif
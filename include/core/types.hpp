@@ -0,0 +1,150 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file types.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_CORE_TYPES
+#define SNAKE_GAME_CORE_TYPES
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     Cell
+    //====================================================
+    /**
+     * @brief Struct used to identify a cell of the board grid.
+     *
+     */
+    struct Cell{
+        int32_t x;
+        int32_t y;
+    };
+
+    //====================================================
+    //     operator==
+    //====================================================
+    /**
+     * @brief Operator used to compare two board cells.
+     *
+     * @param lhs The first cell.
+     * @param rhs The second cell.
+     * @return true If the two cells are the same.
+     * @return false Otherwise.
+     */
+    constexpr bool operator==( const Cell& lhs, const Cell& rhs ){
+        return lhs.x == rhs.x && lhs.y == rhs.y;
+    }
+
+    //====================================================
+    //     operator!=
+    //====================================================
+    /**
+     * @brief Operator used to compare two board cells.
+     *
+     * @param lhs The first cell.
+     * @param rhs The second cell.
+     * @return true If the two cells are different.
+     * @return false Otherwise.
+     */
+    constexpr bool operator!=( const Cell& lhs, const Cell& rhs ){
+        return ! ( lhs == rhs );
+    }
+
+    //====================================================
+    //     Direction
+    //====================================================
+    /**
+     * @brief Enum used to define the snake movement directions.
+     *
+     */
+    enum class Direction: uint8_t{
+        Up = 0,
+        Down,
+        Left,
+        Right
+    };
+
+    //====================================================
+    //     Input
+    //====================================================
+    /**
+     * @brief Enum used to define the input which can be given to a simulation step.
+     *
+     */
+    enum class Input: uint8_t{
+        None = 0,
+        Up,
+        Down,
+        Left,
+        Right
+    };
+
+    //====================================================
+    //     toDirection
+    //====================================================
+    /**
+     * @brief Function used to convert a non-empty input into the corresponding direction.
+     *
+     * @param input The input to be converted.
+     * @return Direction The corresponding direction.
+     */
+    constexpr Direction toDirection( Input input ){
+        return static_cast<Direction>( static_cast<uint8_t>( input ) - 1 );
+    }
+
+    //====================================================
+    //     isOpposite
+    //====================================================
+    /**
+     * @brief Function used to check if two directions are opposite to each other.
+     *
+     * @param first The first direction.
+     * @param second The second direction.
+     * @return true If the directions are opposite.
+     * @return false Otherwise.
+     */
+    constexpr bool isOpposite( Direction first, Direction second ){
+        return ( static_cast<uint8_t>( first ) ^ 1 ) == static_cast<uint8_t>( second );
+    }
+
+    //====================================================
+    //     neighbour
+    //====================================================
+    /**
+     * @brief Function used to get the cell adjacent to another one along a direction.
+     *
+     * @param cell The starting cell.
+     * @param direction The direction to move along.
+     * @return Cell The adjacent cell.
+     */
+    constexpr Cell neighbour( const Cell& cell, Direction direction ){
+        switch( direction ){
+            case Direction::Up:
+                return { cell.x, cell.y - 1 };
+            case Direction::Down:
+                return { cell.x, cell.y + 1 };
+            case Direction::Left:
+                return { cell.x - 1, cell.y };
+            default:
+                return { cell.x + 1, cell.y };
+        }
+    }
+}
+
+#endif
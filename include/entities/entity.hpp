@@ -15,6 +15,17 @@
 #ifndef SNAKE_GAME_BASE_ENTITY
 #define SNAKE_GAME_BASE_ENTITY
 
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/types.hpp>
+#include <core/board.hpp>
+
+// SFML
+#include <SFML/System/Vector2.hpp>
+
 //====================================================
 //     Extra
 //====================================================
@@ -42,6 +53,13 @@ namespace snake::entity{
 
             // Methods
             virtual void draw() const = 0;
+
+            // Static methods
+            static core::Board makeBoard( const window::GameWindow* game_window );
+            static float boardTop( const window::GameWindow* game_window );
+
+            // Constants
+            static constexpr float cell_size{ 25.f };
         
         //====================================================
         //     Protected
@@ -53,9 +71,14 @@ namespace snake::entity{
 
             // Destructor
             virtual ~Entity();   
+
+            // Methods
+            sf::Vector2f cellPosition( const core::Cell& cell ) const;
+            static sf::Vector2f interpolate( const sf::Vector2f& from, const sf::Vector2f& to, float alpha );
             
             // Variables
             window::GameWindow* game_window;
+            float board_top;
     };
 }
 
@@ -18,8 +18,8 @@
 // Entities
 #include <entities/entity.hpp>
 
-// Utility
-#include <utility/gui.hpp>
+// Core
+#include <core/types.hpp>
 
 // SFML
 #include <SFML/Graphics/Sprite.hpp>
@@ -37,7 +37,7 @@ namespace snake::entity{
     //     Body
     //====================================================
     /**
-     * @brief Class used to construct the snake entity.
+     * @brief Class used to draw the food entity, at the position published by the game core.
      * 
      */
     class Food: public Entity{
@@ -52,24 +52,10 @@ namespace snake::entity{
 
             // Methods
             void draw() const override;
-            void respawn();
 
             // Variables
             sf::Sprite food;
-
-        //====================================================
-        //     private
-        //====================================================
-        private:
-
-            // Variables
-            float x_random;
-            float y_random;
-
-            // Constants
-            const int32_t horizontal_line_y_coord = this -> game_window -> getSize().y / 20;
-            const int y_bound{ static_cast<int>( this -> game_window -> getSize().y - this -> game_window -> getSize().y / 10 ) };
-            const int x_bound{ static_cast<int>( this -> game_window -> getSize().x - this -> game_window -> getSize().x / 10 ) };
+            core::Cell position;
     };
 }
 
@@ -25,13 +25,17 @@
 // Entities
 #include <entities/entity.hpp>
 
+// Core
+#include <core/types.hpp>
+#include <core/snapshot.hpp>
+
 // SFML
-#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/System/Vector2.hpp>
 
 // STD
-#include <vector>
-#include <limits>
+#include <cstdint>
 
 namespace snake::entity{
 
@@ -39,7 +43,7 @@ namespace snake::entity{
     //     Body
     //====================================================
     /**
-     * @brief Class used to construct the snake entity.
+     * @brief Class used to draw the snake entity, whose state is held by the game core.
      * 
      */
     class Snake: public Entity{
@@ -50,22 +54,15 @@ namespace snake::entity{
         public:
 
             // Constructors
-            Snake( window::GameWindow* game_window );
+            Snake( window::GameWindow* game_window, const core::SnakeView& model );
 
             // Methods
-            void update();
-            void moveSmoothly( const float dir_x, const float dir_y );
             void draw() const override;
-            void bodyGrow();
-            void relHeadPos( float x, float y );
-            void death();
-            void setGrowPosition( float x, float y );
+            void sync( const core::SnakeView& model );
 
             // Variables
-            float speedV{ 25.f };
             sf::Sprite head;
-            sf::RectangleShape body_shape;
-            std::vector<sf::RectangleShape> body;
+            float interpolation{ 1.f };
             
         //====================================================
         //     Private
@@ -73,16 +70,23 @@ namespace snake::entity{
         private:
 
             // Methods
-            void rotate( float angle );
+            static float headRotation( core::Direction direction );
+            void rebuild();
+            void pushFront( const core::Cell& cell );
+            void writeSlot( uint32_t slot, const sf::Vector2f& center );
 
             // Variables
-            float direction_x;
-            float direction_y;
+            const core::SnakeView* model;
+            sf::VertexArray body_vertices;
+            uint32_t slots;
+            uint32_t front{ 0 };
+            uint32_t count{ 0 };
+            uint64_t synced_moves{ 0 };
 
             // Constants
-            const uint64_t game_window_size_x = this -> game_window -> getSize().x;
-            const float infinitesimal_speedV = std::numeric_limits<float>::epsilon();
-            const float body_dimension = 25.0f;
+            static constexpr float body_dimension{ 25.f };
+            static constexpr float outline_thickness{ 2.f };
+            static constexpr uint32_t vertices_per_slot{ 12 };
     };
 }
 
@@ -26,18 +26,32 @@
 #include <states/state.hpp>
 
 // Entities
+#include <entities/entity.hpp>
 #include <entities/snake.hpp>
 #include <entities/food.hpp>
 
+// Core
+#include <core/game.hpp>
+#include <core/timestep.hpp>
+#include <core/input_queue.hpp>
+#include <core/replay.hpp>
+#include <core/snapshot.hpp>
+
 // SFML
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Audio.hpp>
+#include <SFML/System/Clock.hpp>
 
 // STD
 #include <cstdint>
 #include <memory>
 #include <sstream>
 #include <filesystem>
+#include <optional>
+#include <atomic>
+#include <thread>
 
 namespace snake::state{
 
@@ -58,8 +72,16 @@ namespace snake::state{
             // Constructors
             GameState( window::GameWindow* game_window );
 
+            // Destructor
+            ~GameState() override;
+
             // Methods
             void drawState() override;
+            void updateState( const sf::Time& elapsed ) override;
+            void keyPressed( const sf::Event& event ) override;
+            bool isStatic() const override;
+            void pauseState() override;
+            void resumeState() override;
 
         //====================================================
         //     Private
@@ -68,18 +90,39 @@ namespace snake::state{
 
             // Methods
             void drawEntities() const;
+            void startRendering();
+            void stopRendering();
+            void renderLoop( double tick_duration );
+            void drawFrame( const core::Snapshot& snapshot, float interpolation );
             void updateEntities();
             void gameRules();
             void drawWidgets() override;
             void packWidgets() override;
             void gameOver();
+            void renderHud();
             void loadSounds();
+            static uint64_t gameSeed( window::GameWindow* game_window );
+            static std::optional<core::Replay> loadPlayback();
+            static std::unique_ptr<core::Game> makeGame( window::GameWindow* game_window, const std::optional<core::Replay>& playback );
 
             // Variables
             window::GameWindow* game_window;
-            std::unique_ptr<entity::Snake> snake{ std::make_unique<entity::Snake>( entity::Snake( game_window ) ) };
-            std::unique_ptr<entity::Food> food{ std::make_unique<entity::Food>( entity::Food( game_window ) ) };
-            uint64_t score{ 0 };
+            std::optional<core::Replay> playback{ loadPlayback() };
+            std::unique_ptr<core::Game> game{ makeGame( game_window, playback ) };
+            core::Replay recording{ game -> board, game -> seed };
+            core::SnapshotBuffer<core::Snapshot> snapshots{ core::Snapshot( *game ) };
+            std::unique_ptr<entity::Snake> snake{ std::make_unique<entity::Snake>( game_window, snapshots.front().snake ) };
+            std::unique_ptr<entity::Food> food{ std::make_unique<entity::Food>( game_window ) };
+            sf::Clock snapshot_clock;
+            std::atomic<bool> rendering{ false };
+            std::thread render_thread;
+            uint64_t frame_score{ 0 };
+            uint64_t food_eaten{ 0 };
+            core::StepResult step_result;
+            core::FixedTimestep timestep{ default_ticks_per_second };
+            bool resumed{ false };
+            core::InputQueue input_queue;
+            sf::Clock input_clock;
             uint64_t best_score;
             sf::Text score_update;
             sf::Text best_score_text;
@@ -91,15 +134,20 @@ namespace snake::state{
             sf::RectangleShape title_background;
             std::string background_file;
             std::string player_name;
-            std::string process_background;
             sf::Sound snake_eat;
             sf::Sound snake_looses;
-
-            // Static variables
-            static sf::SoundBuffer state_sound_1;
-            static sf::SoundBuffer state_sound_2;
+            std::unique_ptr<sf::RenderTexture> hud_texture{ std::make_unique<sf::RenderTexture>() };
+            sf::Sprite hud_sprite;
+            bool hud_dirty{ true };
+            uint64_t hud_score;
+            uint64_t hud_best_score;
+            std::string hud_player_name;
 
             // Constants
+            static constexpr int32_t default_speed{ 25 };
+            static constexpr int32_t default_ticks_per_second{ 15 };
+            static constexpr double max_idle_time{ 0.005 };
+            static constexpr double min_frame_time{ 1.0 / 144.0 };
             const uint32_t horizontal_line_y_coord = this -> game_window -> getSize().x / 24;
             const uint32_t window_x_max = this -> game_window -> getSize().x;
             const uint32_t window_y_max = this -> game_window -> getSize().y;
@@ -27,10 +27,11 @@
 
 // SFML
 #include <SFML/Graphics/Sprite.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
 
 // STD
 #include <filesystem>
-#include <fstream>
 
 namespace snake::state{
 
@@ -53,6 +54,10 @@ namespace snake::state{
 
             // Methods
             void drawState() override;
+            void updateState( const sf::Time& elapsed ) override;
+            void textEntered( const sf::Event& event ) override;
+            bool isAnimating() const override;
+            void leaveState() override;
 
         //====================================================
         //     Private
@@ -63,15 +68,17 @@ namespace snake::state{
             void drawImg();
             void drawWidgets() override;
             void packWidgets() override;
-            void fileUpdate( std::string_view option, uint16_t option_idx );
+            void changeOptions();
+            void saveOptions();
 
             // Variables
             window::GameWindow* game_window;
             sf::Text back_to_menu;
             std::filesystem::path options_file_path;
             sf::Sprite settings_logo;
-            std::vector<std::string> lines;
-            std::string input;
+            bool saved_message_visible;
+            bool options_changed;
+            sf::Clock options_clock;
             
             // Player option variables
             sf::Text text_has_been_saved_player;
@@ -95,6 +102,7 @@ namespace snake::state{
             const uint64_t game_window_size_x = this -> game_window -> getSize().x;
             const uint64_t game_window_size_y = this -> game_window -> getSize().y;
             const sf::Time delta_time{ sf::seconds( 1.f ) };
+            const sf::Time save_delay{ sf::seconds( 2.f ) };
     };
 }
 
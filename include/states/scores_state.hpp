@@ -28,7 +28,6 @@
 
 // STD
 #include <vector>
-#include <map>
 
 namespace snake::state{
 
@@ -61,7 +60,6 @@ namespace snake::state{
             void drawImg();
             void drawWidgets() override;
             void packWidgets() override;
-            std::multimap<uint64_t, std::string, std::greater<int64_t>> getScoresMap();
             void initStrings();
 
             // Variables
@@ -70,7 +68,6 @@ namespace snake::state{
             sf::Text first_player;
             sf::Text second_player;
             sf::Text third_player;
-            std::multimap<uint64_t, std::string, std::greater<int64_t>> scores_map;
             sf::Sprite gold_trophy;
             sf::Sprite silver_trophy;
             sf::Sprite bronze_trophy;
@@ -78,7 +75,6 @@ namespace snake::state{
             std::string string_first;
             std::string string_second;
             std::string string_third;
-            std::multimap<uint64_t, std::string, std::greater<int64_t>>::iterator iterator;
 
             // Constants
             const uint64_t game_window_size_x = this -> game_window -> getSize().x;
@@ -23,14 +23,15 @@
 #include <SFML/Graphics/Color.hpp> 
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/System/Time.hpp>
 
 // STD
 #include <cstdint>
 
 // Required by IWYU
 namespace sf { 
-    class Texture; 
     class Font;
+    class Event;
 }
 
 namespace snake::state{
@@ -54,6 +55,14 @@ namespace snake::state{
 
             // Methods
             virtual void drawState() = 0;
+            virtual void updateState( const sf::Time& elapsed );
+            virtual void keyPressed( const sf::Event& event );
+            virtual void textEntered( const sf::Event& event );
+            virtual bool isStatic() const;
+            virtual bool isAnimating() const;
+            virtual void leaveState();
+            virtual void pauseState();
+            virtual void resumeState();
         
         //====================================================
         //     Protected
@@ -78,16 +87,7 @@ namespace snake::state{
             sf::Color activeColor;
             sf::Sprite snake_branch_sprite;
             sf::RectangleShape background;
-
-            // Static variables
-            static sf::Texture state_texture_1;
-            static sf::Texture state_texture_2;
-            static sf::Texture state_texture_3;
-            static sf::Texture state_texture_4;
-            static sf::Texture state_texture_5;
-            static sf::Texture state_texture_6;
-            static sf::Texture state_texture_7;
-            static sf::Font font;
+            const sf::Font& font;
 
             // Constants
             sf::Color background_color{ sf::Color::White };
@@ -0,0 +1,88 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file stats_state.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_STATS_STATE
+#define SNAKE_GAME_STATS_STATE
+
+//====================================================
+//     Headers
+//====================================================
+
+// Windows
+#include <windows/game_window.hpp>
+
+// States
+#include <states/state.hpp>
+
+// SFML
+#include <SFML/Graphics/Text.hpp>
+
+// STD
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+namespace snake::state{
+
+    //====================================================
+    //     StatsState
+    //====================================================
+    /**
+     * @brief Class used to create the player statistics view, reached from the scores menu.
+     *
+     */
+    class StatsState: public State{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            StatsState( window::GameWindow* game_window );
+
+            // Methods
+            void drawState() override;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Methods
+            void drawImg();
+            void drawWidgets() override;
+            void packWidgets() override;
+            void initStrings();
+
+            // Constants
+            static constexpr uint32_t max_players{ 8 };
+            static constexpr const char* headers[]{ "Player", "Games", "Best", "Mean", "Food", "Time", "Last scores" };
+            static constexpr float column_positions[]{ 0.06f, 0.24f, 0.34f, 0.43f, 0.53f, 0.63f, 0.74f };
+
+            // Variables
+            window::GameWindow* game_window;
+            sf::Text back_to_scores;
+            sf::Text title;
+            std::array<sf::Text, std::size( headers )> columns;
+            std::array<std::string, std::size( headers )> column_strings;
+
+            // Constants
+            const uint64_t game_window_size_x = this -> game_window -> getSize().x;
+            const uint64_t game_window_size_y = this -> game_window -> getSize().y;
+    };
+}
+
+#endif
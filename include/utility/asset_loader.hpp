@@ -0,0 +1,111 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file asset_loader.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_ASSET_LOADER
+#define SNAKE_GAME_ASSET_LOADER
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/thread_pool.hpp>
+
+// SFML
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Config.hpp>
+#include <SFML/System/Time.hpp>
+
+// STD
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace snake::utility{
+
+    //====================================================
+    //     AssetLoader
+    //====================================================
+    /**
+     * @brief Class used to fill the resource cache in the background. Files are read (unless the asset archive contains them), and images and sounds decoded, in parallel by a thread pool as soon as the loader is created, while the thread owning the window context uploads the decoded assets into the cache a few at a time, between two frames. Assets already in the cache are skipped.
+     *
+     */
+    class AssetLoader{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            AssetLoader( const std::vector<std::string>& textures, const std::vector<std::string>& fonts, const std::vector<std::string>& sound_buffers );
+
+            // Destructor
+            ~AssetLoader();
+
+            // Methods
+            bool upload( const sf::Time& budget );
+
+            // Getters
+            float progress() const;
+
+            // Operators
+            AssetLoader( const AssetLoader& ) = delete;
+            AssetLoader& operator=( const AssetLoader& ) = delete;
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Enums
+            enum class Kind: uint8_t{
+                Texture,
+                Font,
+                SoundBuffer
+            };
+
+            // Structs
+            struct Asset{
+                Kind kind;
+                std::string path;
+                std::optional<std::string_view> packed;
+                sf::Image image;
+                std::vector<char> file;
+                std::vector<sf::Int16> samples;
+                uint32_t channel_count{ 0 };
+                uint32_t sample_rate{ 0 };
+                bool decoded{ false };
+            };
+
+            // Methods
+            void add( Kind kind, const std::vector<std::string>& paths );
+            void decode( Asset& asset ) const;
+
+            // Variables
+            std::vector<Asset> assets;
+            std::vector<uint64_t> ready;
+            std::vector<uint64_t> pending;
+            uint64_t uploaded{ 0 };
+            std::mutex mutex;
+            std::atomic<bool> cancelled{ false };
+            core::WorkStealingPool pool{ 0 };
+    };
+}
+
+#endif
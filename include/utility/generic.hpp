@@ -20,31 +20,22 @@
 //====================================================
 
 // STD
+#include <cstdint>
 #include <random>
 
 namespace snake::utility{
 
     //====================================================
-    //     Preprocessor directives
+    //     randomSeed
     //====================================================
     /**
-     * @brief Function used to generate random number in a range.
+     * @brief Function used to draw a non-deterministic seed, for games which are not given one. It should be called once per game, since each call may be a system call.
      * 
-     * @tparam T The type of the random number range.
-     * @param range_from The starting range value.
-     * @param range_to The ending range value.
-     * @return T The type of the return number.
+     * @return uint64_t The seed.
      */
-    template<typename T>
-    inline T random( T range_from, T range_to ){
-
-        // Initialize random number generator
+    inline uint64_t randomSeed(){
         std::random_device rand_dev;
-        std::mt19937 generator( rand_dev() );
-        std::uniform_int_distribution<T> distr( range_from, range_to );
-
-        // Return the random number
-        return distr( generator );
+        return ( static_cast<uint64_t>( rand_dev() ) << 32 ) ^ rand_dev();
     }
 }
 
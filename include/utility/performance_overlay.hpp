@@ -0,0 +1,104 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file performance_overlay.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_PERFORMANCE_OVERLAY
+#define SNAKE_GAME_PERFORMANCE_OVERLAY
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/frame_profile.hpp>
+
+// SFML
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/System/Clock.hpp>
+
+// STD
+#include <atomic>
+#include <cstdint>
+
+//====================================================
+//     Required by IWYU
+//====================================================
+namespace snake {
+    namespace window {
+        class BaseWindow;
+    }
+}
+
+namespace snake::utility{
+
+    //====================================================
+    //     PerformanceOverlay
+    //====================================================
+    /**
+     * @brief Class used to show the frame timings of the game on top of it: frames per second, a graph of the last frame times, the duration of each frame phase, the draw calls of the last frame and the resources loaded from file.
+     *
+     */
+    class PerformanceOverlay{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Constructors
+            PerformanceOverlay();
+
+            // Methods
+            void frame( window::BaseWindow& window );
+
+            // Setters
+            void setFont( const sf::Font& font );
+
+            // Variables
+            core::FrameProfile profile;
+            std::atomic<bool> visible{ false };
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Methods
+            void refreshText( const window::BaseWindow& window );
+            void buildGraph();
+
+            // Variables
+            sf::Text text;
+            sf::RectangleShape panel;
+            sf::VertexArray graph;
+            sf::Clock frame_clock;
+            sf::Clock refresh_clock;
+            uint64_t sampled_loads{ 0 };
+            uint64_t frame_loads{ 0 };
+            uint64_t max_frame_loads{ 0 };
+
+            // Constants
+            static constexpr float refresh_time{ 0.25f };
+            static constexpr float margin{ 10.f };
+            static constexpr float bar_width{ 2.f };
+            static constexpr float graph_height{ 60.f };
+            static constexpr double graph_max_time{ 0.05 };
+            static constexpr double frame_budget{ 1.0 / 60.0 };
+            static constexpr uint32_t text_size{ 16 };
+    };
+}
+
+#endif
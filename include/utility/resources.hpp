@@ -0,0 +1,91 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file resources.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_RESOURCES_UTILITY
+#define SNAKE_GAME_RESOURCES_UTILITY
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/asset_archive.hpp>
+
+// SFML
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Config.hpp>
+
+// STD
+#include <string>
+#include <unordered_map>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+namespace snake::utility{
+
+    //====================================================
+    //     Resources
+    //====================================================
+    /**
+     * @brief Class used to load each texture, font and sound buffer once, keyed by its file path. Returned references stay valid until the end of the program. Files are read from the mounted asset archive when it contains them, from disk otherwise.
+     * 
+     */
+    class Resources{
+
+        //====================================================
+        //     Public
+        //====================================================
+        public:
+
+            // Static methods
+            static bool mount( const std::filesystem::path& archive_path );
+            static std::optional<std::string_view> packed( const std::string& path );
+            static const sf::Texture& texture( const std::string& path );
+            static const sf::Font& font( const std::string& path );
+            static const sf::SoundBuffer& soundBuffer( const std::string& path );
+            static uint64_t loads();
+            static bool cached( const std::string& path );
+            static void storeTexture( const std::string& path, const sf::Image& image );
+            static void storeFont( const std::string& path, std::vector<char> file );
+            static void storeSoundBuffer( const std::string& path, const std::vector<sf::Int16>& samples, uint32_t channel_count, uint32_t sample_rate );
+
+        //====================================================
+        //     Private
+        //====================================================
+        private:
+
+            // Static methods
+            template <typename T>
+            static const T& load( std::unordered_map<std::string, T>& cache, const std::string& path );
+            template <typename T, typename Loader>
+            static void insert( std::unordered_map<std::string, T>& cache, const std::string& path, Loader load_resource );
+
+            // Static variables
+            static core::AssetArchive archive;
+            static std::unordered_map<std::string, sf::Texture> textures;
+            static std::unordered_map<std::string, sf::Font> fonts;
+            static std::unordered_map<std::string, sf::SoundBuffer> sound_buffers;
+            static std::unordered_map<std::string, std::vector<char>> font_files;
+            static std::atomic<uint64_t> load_count;
+    };
+}
+
+#endif
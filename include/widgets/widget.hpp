@@ -24,20 +24,14 @@
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/Text.hpp>
+#include <SFML/System/String.hpp>
 #include <SFML/System/Vector2.hpp>
-#include <SFML/Window/Mouse.hpp>
 
 // STD
+#include <atomic>
 #include <cstdint>
 #include <string>
 
-//====================================================
-//     Required by IWYU
-//====================================================
-namespace sf{
-    class SoundBuffer;
-}
-
 namespace snake::widget{
 
     //====================================================
@@ -76,14 +70,16 @@ namespace snake::widget{
 
             // pack (template)
             /**
-             * @brief Method used to draw the widget in the window target.
+             * @brief Method used to draw the widget in the window target. The text is laid out again only if it changed, and the mouse position is the one tracked by the window events.
              * 
              * @param target The target to which the widget is drawn in.
              */
             template <typename T>
             void pack( T* target ){
-                this -> centering();
-                this -> update( target -> mapPixelToCoords( sf::Mouse::getPosition( *target ) ) );
+                if( this -> layout_dirty ){
+                    this -> centering();
+                }
+                this -> update( target -> mapPixelToCoords( target -> mouse_position ) );
                 this -> render( target );
             }
 
@@ -91,6 +87,13 @@ namespace snake::widget{
             bool focus;
             sf::RectangleShape shape;
             sf::Text text;
+
+            // Static methods
+            static void updateText( sf::Text& text, const sf::String& string );
+            static void updateText( sf::Text& text, const sf::Font& font, const sf::String& string );
+
+            // Static variables
+            static std::atomic<uint32_t> geometry_rebuilds;
         
         //====================================================
         //     Protected
@@ -106,6 +109,8 @@ namespace snake::widget{
             virtual void update( const sf::Vector2f mousePos ) = 0;
             virtual void loadSounds() = 0;
             void centering();
+            void setString( const sf::String& string );
+            void setShapeColor( const sf::Color& color );
 
             // render (template)
             /**
@@ -120,16 +125,12 @@ namespace snake::widget{
             }
 
             // Variables
-            sf::Font font;
+            const sf::Font& font;
             sf::Color idleColor;
             sf::Color hoverColor;
             sf::Color activeColor;
             uint16_t widgetState;
-
-            // Static variables
-            static sf::SoundBuffer widget_sound_1;
-            static sf::SoundBuffer widget_sound_2;
-            static sf::SoundBuffer widget_sound_3;
+            bool layout_dirty{ true };
     };
 }
 
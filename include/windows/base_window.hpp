@@ -22,11 +22,14 @@
 // SFML
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Window/VideoMode.hpp>
+#include <SFML/System/Vector2.hpp>
 
 // STD
 #include <memory>
 #include <unordered_map>
 #include <string_view>
+#include <cstdint>
+#include <utility>
 
 //====================================================
 //     Required by IWYU
@@ -60,9 +63,28 @@ namespace snake::window{
             // Constants
             const sf::VideoMode desktop{ sf::VideoMode::getDesktopMode() };
 
+            // Methods
+            void display();
+
+            // draw (template)
+            /**
+             * @brief Method used to draw into the window, counting the draw calls of the current frame. It hides the RenderTarget overloads, so every draw made through a window pointer is counted.
+             * 
+             * @param args The arguments of the RenderTarget draw overload to be called.
+             */
+            template <typename... Args>
+            void draw( Args&&... args ){
+                this -> draw_calls++;
+                sf::RenderWindow::draw( std::forward<Args>( args )... );
+            }
+
             // Variables
             std::unordered_map<std::string_view, std::shared_ptr<state::State>> game_window_states;
             std::unordered_map<std::string_view, std::shared_ptr<state::State>> pause_window_states;
+            sf::Vector2i mouse_position;
+            uint32_t draw_calls{ 0 };
+            uint32_t frame_draw_calls{ 0 };
+            uint32_t frame_geometry_rebuilds{ 0 };
 
         //====================================================
         //     Protected
@@ -71,6 +93,16 @@ namespace snake::window{
 
             // Destructor
             virtual ~BaseWindow();
+
+            // Methods
+            bool waitStateEvent( sf::Event& event, const state::State& state );
+
+            // Variables
+            const state::State* drawn_state{ nullptr };
+
+            // Constants
+            static constexpr uint16_t idle_poll_time{ 10 };
+            static constexpr uint16_t idle_frame_time{ 50 };
         
         //====================================================
         //     Private
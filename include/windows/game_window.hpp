@@ -22,9 +22,20 @@
 // Windows
 #include <windows/base_window.hpp>
 
+// Utility
+#include <utility/performance_overlay.hpp>
+
+// Core
+#include <core/io_worker.hpp>
+#include <core/options.hpp>
+#include <core/score_store.hpp>
+#include <core/stats_store.hpp>
+
 // SFML
 #include <SFML/Window/Event.hpp>
 #include <SFML/Audio/Sound.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
 
 // STD
 #include <sstream> // Required for MacOS
@@ -32,16 +43,9 @@
 #include <cstdlib>
 #include <string>
 #include <fstream>
-#include <array>
 #include <cstdint>
 #include <vector>
-
-//====================================================
-//     Required by IWYU
-//====================================================
-namespace sf{
-    class SoundBuffer;
-}
+#include <optional>
 
 namespace snake::window{
 
@@ -62,17 +66,25 @@ namespace snake::window{
             // Constructors
             GameWindow();
 
-            // Methods
-            std::string processInputFile( std::ifstream input_stream, int16_t row_n, int16_t pos );
+            // Destructor
+            ~GameWindow() override;
 
             // Variables
             sf::Event game_event;
-            std::string player_option;
-            std::string speed_option;
-            std::string background_option;
+            core::Options options;
             std::filesystem::path options_file_path;
             std::filesystem::path score_file_path;
-            std::vector<uint64_t> scores_container;
+            std::filesystem::path replay_directory_path;
+            std::filesystem::path stats_file_path;
+            uint64_t next_replay{ 1 };
+            core::ScoreStore score_store;
+            core::StatsStore stats_store;
+            utility::PerformanceOverlay performance_overlay;
+
+            // Static variables
+            static std::optional<uint64_t> seed_option;
+            static std::optional<std::filesystem::path> replay_option;
+            static core::IoWorker io_worker;
 
             // Constants
             const std::string username = getenv( "USERNAME" );
@@ -84,24 +96,25 @@ namespace snake::window{
 
             // Methods
             void runWindow();
+            void processEvent( const sf::Event& event );
             void eventClosed();
             void eventKeyPressed( const sf::Event& event ) override;
-            std::vector<uint64_t> getScoresContainer() const;
+            void openScoreStore();
             void createGameFiles();
+            void loadAssets();
             void loadSounds();
 
             // Variables
             std::ostringstream game_directory_oss;
             std::ostringstream options_file_oss;
             std::ostringstream score_file_oss;
-            std::string input;
-            std::array<std::string, 2> strings;
-            std::vector<std::string> lines;
-            std::stringstream words;
+            std::ostringstream replay_directory_oss;
+            std::ostringstream stats_file_oss;
             sf::Sound open_pause_window_sound;
+            sf::Clock frame_clock;
 
-            // Static variables
-            static sf::SoundBuffer window_sound_1;
+            // Constants
+            const sf::Time upload_budget = sf::milliseconds( 8 );
     };
 }
 
@@ -62,6 +62,7 @@ namespace snake::window{
 
             // Methods
             void runWindow();
+            void processEvent( const sf::Event& event );
             void eventClosed();
             void eventKeyPressed( const sf::Event& event ) override;
     };
@@ -0,0 +1,299 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file asset_archive.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/asset_archive.hpp>
+#include <core/binary_io.hpp>
+
+// System
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+    #ifdef __APPLE__
+        #include <mach-o/dyld.h>
+    #endif
+#endif
+
+// STD
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     AssetArchive (destructor)
+    //====================================================
+    /**
+     * @brief Destructor of the AssetArchive class, which unmaps the archive.
+     *
+     */
+    AssetArchive::~AssetArchive(){
+        this -> close();
+    }
+
+    //====================================================
+    //     open
+    //====================================================
+    /**
+     * @brief Method used to map an archive into memory and to read its index. A previously opened archive is closed first.
+     *
+     * @param path The archive file path.
+     * @return true If the archive has been opened.
+     * @return false If the file does not exist or is not a valid archive.
+     */
+    bool AssetArchive::open( const std::filesystem::path& path ){
+        this -> close();
+
+        #ifdef _WIN32
+            const HANDLE file = CreateFileW( path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+            if( file == INVALID_HANDLE_VALUE ){
+                return false;
+            }
+            LARGE_INTEGER file_size{};
+            const HANDLE file_mapping = GetFileSizeEx( file, &file_size ) && file_size.QuadPart > 0 ?
+                CreateFileMappingW( file, nullptr, PAGE_READONLY, 0, 0, nullptr ) : nullptr;
+            CloseHandle( file );
+            if( file_mapping == nullptr ){
+                return false;
+            }
+            const void* view = MapViewOfFile( file_mapping, FILE_MAP_READ, 0, 0, 0 );
+            if( view == nullptr ){
+                CloseHandle( file_mapping );
+                return false;
+            }
+            this -> mapping = file_mapping;
+            this -> data = static_cast<const char*>( view );
+            this -> data_size = static_cast<size_t>( file_size.QuadPart );
+        #else
+            const int file = ::open( path.c_str(), O_RDONLY );
+            if( file < 0 ){
+                return false;
+            }
+            struct stat file_status{};
+            void* view = fstat( file, &file_status ) == 0 && file_status.st_size > 0 ?
+                mmap( nullptr, static_cast<size_t>( file_status.st_size ), PROT_READ, MAP_PRIVATE, file, 0 ) : MAP_FAILED;
+            ::close( file );
+            if( view == MAP_FAILED ){
+                return false;
+            }
+            this -> mapping = view;
+            this -> data = static_cast<const char*>( view );
+            this -> data_size = static_cast<size_t>( file_status.st_size );
+        #endif
+
+        if( ! this -> readIndex() ){
+            this -> close();
+            return false;
+        }
+        return true;
+    }
+
+    //====================================================
+    //     close
+    //====================================================
+    /**
+     * @brief Method used to unmap the archive. File contents returned so far become invalid.
+     *
+     */
+    void AssetArchive::close(){
+        if( this -> mapping != nullptr ){
+            #ifdef _WIN32
+                UnmapViewOfFile( this -> data );
+                CloseHandle( this -> mapping );
+            #else
+                munmap( this -> mapping, this -> data_size );
+            #endif
+        }
+        this -> mapping = nullptr;
+        this -> data = nullptr;
+        this -> data_size = 0;
+        this -> entries.clear();
+    }
+
+    //====================================================
+    //     find
+    //====================================================
+    /**
+     * @brief Method used to get the content of a packed file.
+     *
+     * @param path The file path, relative to the packed root and with forward slashes (e.g. "img/textures/food.png").
+     * @return std::optional<std::string_view> The file content, or nothing if the file is not in the archive.
+     */
+    std::optional<std::string_view> AssetArchive::find( const std::string& path ) const {
+        if( const auto found = this -> entries.find( path ); found != this -> entries.end() ){
+            return found -> second;
+        }
+        return std::nullopt;
+    }
+
+    //====================================================
+    //     size
+    //====================================================
+    /**
+     * @brief Getter used to get the number of packed files.
+     *
+     * @return size_t The number of files.
+     */
+    size_t AssetArchive::size() const {
+        return this -> entries.size();
+    }
+
+    //====================================================
+    //     pack
+    //====================================================
+    /**
+     * @brief Method used to write an archive with every file found in some directories. The archive starts with an index of the files (path size, path, offset and size of each one, integers in little endian order), followed by the file contents.
+     *
+     * @param archive_path The path of the archive to be written.
+     * @param root The directory to which the packed paths are relative.
+     * @param directories The directories to be packed, relative to the root.
+     * @return uint64_t The number of packed files.
+     */
+    uint64_t AssetArchive::pack( const std::filesystem::path& archive_path, const std::filesystem::path& root, const std::vector<std::filesystem::path>& directories ){
+
+        // Collect the files, in a stable order
+        std::vector<std::string> paths;
+        for( const auto& directory: directories ){
+            for( const auto& entry: std::filesystem::recursive_directory_iterator( root / directory ) ){
+                if( entry.is_regular_file() ){
+                    paths.push_back( entry.path().lexically_relative( root ).generic_string() );
+                }
+            }
+        }
+        std::sort( paths.begin(), paths.end() );
+
+        // Write the index
+        uint64_t offset = sizeof( magic ) + 1 + 4;
+        for( const auto& path: paths ){
+            offset += 4 + path.size() + 8 + 8;
+        }
+        std::ofstream archive( archive_path, std::ios::binary );
+        archive.write( magic, sizeof( magic ) );
+        archive.put( static_cast<char>( version ) );
+        writeInteger( archive, paths.size(), 4 );
+        for( const auto& path: paths ){
+            const uint64_t size = std::filesystem::file_size( root / path );
+            writeInteger( archive, path.size(), 4 );
+            archive.write( path.data(), static_cast<std::streamsize>( path.size() ) );
+            writeInteger( archive, offset, 8 );
+            writeInteger( archive, size, 8 );
+            offset += size;
+        }
+
+        // Write the contents (streaming an empty file would fail the archive stream)
+        for( const auto& path: paths ){
+            std::ifstream file( root / path, std::ios::binary );
+            if( ! file ){
+                throw std::runtime_error( "Cannot read " + path );
+            }
+            if( std::filesystem::file_size( root / path ) > 0 ){
+                archive << file.rdbuf();
+            }
+        }
+        if( ! archive ){
+            throw std::runtime_error( "Cannot write " + archive_path.string() );
+        }
+
+        return paths.size();
+    }
+
+    //====================================================
+    //     defaultPath
+    //====================================================
+    /**
+     * @brief Method used to get the path at which the build places the archive, next to the game executable, so that it does not depend on the working directory.
+     *
+     * @param argv0 The first program argument, used if the executable cannot be asked to the system.
+     * @return std::filesystem::path The archive path.
+     */
+    std::filesystem::path AssetArchive::defaultPath( const char* argv0 ){
+        std::filesystem::path executable;
+        std::error_code error;
+
+        #if defined( _WIN32 )
+            wchar_t buffer[ MAX_PATH ];
+            const DWORD length = GetModuleFileNameW( nullptr, buffer, MAX_PATH );
+            if( length > 0 && length < MAX_PATH ){
+                executable = std::wstring( buffer, length );
+            }
+        #elif defined( __APPLE__ )
+            char buffer[ 4096 ];
+            uint32_t length = sizeof( buffer );
+            if( _NSGetExecutablePath( buffer, &length ) == 0 ){
+                executable = buffer;
+            }
+        #else
+            executable = std::filesystem::read_symlink( "/proc/self/exe", error );
+        #endif
+
+        if( executable.empty() && argv0 != nullptr ){
+            executable = std::filesystem::absolute( argv0, error );
+        }
+        return executable.parent_path() / "assets.pack";
+    }
+
+    //====================================================
+    //     readIndex
+    //====================================================
+    /**
+     * @brief Method used to read the index of the mapped archive, checking that every file lies within it.
+     *
+     * @return true If the index is valid.
+     * @return false Otherwise.
+     */
+    bool AssetArchive::readIndex(){
+        size_t cursor = sizeof( magic ) + 1 + 4;
+        if( this -> data_size < cursor || ! std::equal( std::begin( magic ), std::end( magic ), this -> data ) || static_cast<uint8_t>( this -> data[ sizeof( magic ) ] ) != version ){
+            return false;
+        }
+
+        const uint64_t count = readInteger( this -> data + sizeof( magic ) + 1, 4 );
+        for( uint64_t i = 0; i < count; ++i ){
+            if( this -> data_size - cursor < 4 ){
+                return false;
+            }
+            const uint64_t path_size = readInteger( this -> data + cursor, 4 );
+            cursor += 4;
+            if( this -> data_size - cursor < path_size + 16 ){
+                return false;
+            }
+            std::string path( this -> data + cursor, path_size );
+            cursor += path_size;
+            const uint64_t offset = readInteger( this -> data + cursor, 8 );
+            const uint64_t size = readInteger( this -> data + cursor + 8, 8 );
+            cursor += 16;
+            if( offset > this -> data_size || size > this -> data_size - offset ){
+                return false;
+            }
+            this -> entries.emplace( std::move( path ), std::string_view( this -> data + offset, size ) );
+        }
+        return true;
+    }
+}
@@ -0,0 +1,145 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file batch.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/batch.hpp>
+#include <core/board.hpp>
+#include <core/game.hpp>
+#include <core/bot.hpp>
+#include <core/thread_pool.hpp>
+
+// STD
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     add
+    //====================================================
+    /**
+     * @brief Method used to add the outcome of a game.
+     *
+     * @param score The final score.
+     * @param length The final snake length.
+     * @param ticks The number of played ticks.
+     * @param won If the snake filled the whole board.
+     */
+    void BatchStats::add( uint64_t score, uint64_t length, uint64_t ticks, bool won ){
+        this -> games += 1;
+        this -> wins += won;
+        this -> total_score += score;
+        this -> max_score = std::max( this -> max_score, score );
+        this -> total_length += length;
+        this -> max_length = std::max( this -> max_length, length );
+        this -> total_ticks += ticks;
+    }
+
+    //====================================================
+    //     merge
+    //====================================================
+    /**
+     * @brief Method used to add the games of another batch.
+     *
+     * @param other The other batch.
+     */
+    void BatchStats::merge( const BatchStats& other ){
+        this -> games += other.games;
+        this -> wins += other.wins;
+        this -> total_score += other.total_score;
+        this -> max_score = std::max( this -> max_score, other.max_score );
+        this -> total_length += other.total_length;
+        this -> max_length = std::max( this -> max_length, other.max_length );
+        this -> total_ticks += other.total_ticks;
+    }
+
+    //====================================================
+    //     meanScore
+    //====================================================
+    /**
+     * @brief Getter used to get the mean score of a game.
+     *
+     * @return double The mean score.
+     */
+    double BatchStats::meanScore() const {
+        return this -> games == 0 ? 0.0 : static_cast<double>( this -> total_score ) / this -> games;
+    }
+
+    //====================================================
+    //     meanLength
+    //====================================================
+    /**
+     * @brief Getter used to get the mean final length of the snake.
+     *
+     * @return double The mean length.
+     */
+    double BatchStats::meanLength() const {
+        return this -> games == 0 ? 0.0 : static_cast<double>( this -> total_length ) / this -> games;
+    }
+
+    //====================================================
+    //     ticksPerSecond
+    //====================================================
+    /**
+     * @brief Getter used to get the simulation throughput of the whole batch.
+     *
+     * @return double The simulated ticks per wall clock second.
+     */
+    double BatchStats::ticksPerSecond() const {
+        return this -> seconds <= 0.0 ? 0.0 : this -> total_ticks / this -> seconds;
+    }
+
+    //====================================================
+    //     runBatch
+    //====================================================
+    /**
+     * @brief Function used to play a batch of independent headless games with the greedy bot, on a work stealing thread pool. Game i uses seed first_seed + i, so a batch is reproducible whatever the number of threads.
+     *
+     * @param board The board of every game.
+     * @param games The number of games.
+     * @param first_seed The seed of the first game.
+     * @param threads The number of threads (zero uses every hardware thread).
+     * @param max_ticks The maximum number of ticks of a game, since the bot may loop forever.
+     * @return BatchStats The aggregated outcome.
+     */
+    BatchStats runBatch( const Board& board, uint64_t games, uint64_t first_seed, uint32_t threads, uint64_t max_ticks ){
+        WorkStealingPool pool( threads );
+
+        // One partial result per worker, on separate cache lines
+        struct alignas( 64 ) Partial{
+            BatchStats stats;
+        };
+        std::vector<Partial> partials( pool.size() );
+
+        const auto start = std::chrono::steady_clock::now();
+        pool.run( games, [ & ]( uint32_t worker, uint64_t task ){
+            Game game( board, first_seed + task );
+            bool won = false;
+            while( game.alive && game.ticks < max_ticks ){
+                won = game.step( greedyInput( game ) ).won;
+            }
+            partials[ worker ].stats.add( game.score, game.snake.length(), game.ticks, won );
+        } );
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        BatchStats stats;
+        for( const auto& partial: partials ){
+            stats.merge( partial.stats );
+        }
+        stats.seconds = elapsed.count();
+        return stats;
+    }
+}
@@ -0,0 +1,97 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file board.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/board.hpp>
+#include <core/types.hpp>
+
+// STD
+#include <cstdint>
+#include <stdexcept>
+
+namespace snake::core{
+
+    //====================================================
+    //     Board (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the Board class.
+     *
+     * @param width Number of board columns.
+     * @param height Number of board rows.
+     */
+    Board::Board( int32_t width, int32_t height ):
+        width( width ),
+        height( height ){
+
+        if( width < this -> min_size || height < this -> min_size ){
+            throw std::invalid_argument( "The game board is too small!" );
+        }
+    }
+
+    //====================================================
+    //     contains
+    //====================================================
+    /**
+     * @brief Method used to check if a cell lies inside the board.
+     *
+     * @param cell The cell to be checked.
+     * @return true If the cell is inside the board.
+     * @return false Otherwise.
+     */
+    bool Board::contains( const Cell& cell ) const {
+        return cell.x >= 0 && cell.x < this -> width && cell.y >= 0 && cell.y < this -> height;
+    }
+
+    //====================================================
+    //     index
+    //====================================================
+    /**
+     * @brief Method used to get the linear index of a cell inside the board.
+     *
+     * @param cell The cell, which must be inside the board.
+     * @return uint32_t The linear index of the cell.
+     */
+    uint32_t Board::index( const Cell& cell ) const {
+        return static_cast<uint32_t>( cell.y ) * static_cast<uint32_t>( this -> width ) + static_cast<uint32_t>( cell.x );
+    }
+
+    //====================================================
+    //     cell
+    //====================================================
+    /**
+     * @brief Method used to get the cell corresponding to a linear index.
+     *
+     * @param index The linear index of the cell.
+     * @return Cell The corresponding cell.
+     */
+    Cell Board::cell( uint32_t index ) const {
+        return { 
+            static_cast<int32_t>( index % static_cast<uint32_t>( this -> width ) ), 
+            static_cast<int32_t>( index / static_cast<uint32_t>( this -> width ) ) 
+        };
+    }
+
+    //====================================================
+    //     size
+    //====================================================
+    /**
+     * @brief Method used to get the total number of cells of the board.
+     *
+     * @return uint32_t The number of cells.
+     */
+    uint32_t Board::size() const {
+        return static_cast<uint32_t>( this -> width ) * static_cast<uint32_t>( this -> height );
+    }
+}
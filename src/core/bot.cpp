@@ -0,0 +1,59 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file bot.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/bot.hpp>
+#include <core/types.hpp>
+#include <core/game.hpp>
+
+// STD
+#include <cstdint>
+#include <cstdlib>
+
+namespace snake::core{
+
+    //====================================================
+    //     greedyInput
+    //====================================================
+    /**
+     * @brief Function used to choose the input of a simple bot, which moves to the safe neighbour cell closest to the food. If no neighbour is safe it keeps its direction.
+     *
+     * @param game The game being played.
+     * @return Input The chosen input.
+     */
+    Input greedyInput( const Game& game ){
+        const Cell head = game.snake.head();
+        const Cell food = game.food.position;
+        Direction best = game.snake.last_direction;
+        int32_t best_distance = INT32_MAX;
+
+        for( uint8_t i = 0; i < 4; i++ ){
+            const auto direction = static_cast<Direction>( i );
+            if( isOpposite( direction, game.snake.last_direction ) ){
+                continue;
+            }
+            const Cell next = neighbour( head, direction );
+            if( game.snake.collides( next, next != food ) ){
+                continue;
+            }
+            const int32_t distance = std::abs( next.x - food.x ) + std::abs( next.y - food.y );
+            if( distance < best_distance ){
+                best = direction;
+                best_distance = distance;
+            }
+        }
+
+        return best == game.snake.last_direction ? Input::None : static_cast<Input>( static_cast<uint8_t>( best ) + 1 );
+    }
+}
@@ -0,0 +1,57 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file food.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/food.hpp>
+#include <core/occupancy.hpp>
+#include <core/random.hpp>
+
+// STD
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     Food (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the Food class. The food is placed in a random free cell.
+     *
+     * @param occupancy The occupancy map of the board.
+     * @param random The random engine of the game session.
+     */
+    Food::Food( const Occupancy& occupancy, Random& random ):
+        position{ 0, 0 }{
+        this -> respawn( occupancy, random );
+    }
+
+    //====================================================
+    //     respawn
+    //====================================================
+    /**
+     * @brief Method used to move the food into a cell drawn uniformly among the free ones, which never lies under the snake and never needs retries.
+     *
+     * @param occupancy The occupancy map of the board.
+     * @param random The random engine of the game session.
+     * @return true If the food has been placed.
+     * @return false If there is no free cell left.
+     */
+    bool Food::respawn( const Occupancy& occupancy, Random& random ){
+        if( occupancy.freeCount() == 0 ){
+            return false;
+        }
+        this -> position = occupancy.freeCell( random.uniform( occupancy.freeCount() ) );
+        return true;
+    }
+}
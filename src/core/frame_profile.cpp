@@ -0,0 +1,149 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file frame_profile.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/frame_profile.hpp>
+
+// STD
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     addPhase
+    //====================================================
+    /**
+     * @brief Method used to add a measured duration of a phase. The stored value is an exponential moving average, so that a single spike is visible without making the readout flicker.
+     *
+     * @param phase The timed phase.
+     * @param seconds The phase duration.
+     */
+    void FrameProfile::addPhase( Phase phase, double seconds ){
+        auto& average = this -> phases[ static_cast<uint8_t>( phase ) ];
+        const double previous = average.load( std::memory_order_relaxed );
+        average.store( previous + ( seconds - previous ) * smoothing, std::memory_order_relaxed );
+    }
+
+    //====================================================
+    //     addFrame
+    //====================================================
+    /**
+     * @brief Method used to add the duration of a frame to the history, replacing the oldest one once the history is full.
+     *
+     * @param seconds The frame duration.
+     */
+    void FrameProfile::addFrame( double seconds ){
+        this -> history[ this -> next ] = seconds;
+        this -> next = ( this -> next + 1 ) % history_size;
+        this -> count = std::min( this -> count + 1, history_size );
+    }
+
+    //====================================================
+    //     phase
+    //====================================================
+    /**
+     * @brief Getter used to get the smoothed duration of a phase.
+     *
+     * @param phase The timed phase.
+     * @return double The phase duration, in seconds.
+     */
+    double FrameProfile::phase( Phase phase ) const {
+        return this -> phases[ static_cast<uint8_t>( phase ) ].load( std::memory_order_relaxed );
+    }
+
+    //====================================================
+    //     frameTime
+    //====================================================
+    /**
+     * @brief Getter used to get the duration of a recent frame.
+     *
+     * @param age How many frames back, 0 being the newest; it must be lower than frames().
+     * @return double The frame duration, in seconds.
+     */
+    double FrameProfile::frameTime( uint32_t age ) const {
+        return this -> history[ ( this -> next + history_size - 1 - age ) % history_size ];
+    }
+
+    //====================================================
+    //     meanFrameTime
+    //====================================================
+    /**
+     * @brief Getter used to get the mean duration of the frames in the history.
+     *
+     * @return double The mean frame duration, in seconds, or 0 if no frame has been added.
+     */
+    double FrameProfile::meanFrameTime() const {
+        double total = 0.0;
+        for( uint32_t age = 0; age < this -> count; age++ ){
+            total += this -> frameTime( age );
+        }
+        return this -> count == 0 ? 0.0 : total / this -> count;
+    }
+
+    //====================================================
+    //     maxFrameTime
+    //====================================================
+    /**
+     * @brief Getter used to get the longest frame in the history.
+     *
+     * @return double The longest frame duration, in seconds.
+     */
+    double FrameProfile::maxFrameTime() const {
+        double longest = 0.0;
+        for( uint32_t age = 0; age < this -> count; age++ ){
+            longest = std::max( longest, this -> frameTime( age ) );
+        }
+        return longest;
+    }
+
+    //====================================================
+    //     frames
+    //====================================================
+    /**
+     * @brief Getter used to get the number of frames in the history.
+     *
+     * @return uint32_t The number of frames, up to history_size.
+     */
+    uint32_t FrameProfile::frames() const {
+        return this -> count;
+    }
+
+    //====================================================
+    //     phaseName
+    //====================================================
+    /**
+     * @brief Static method used to get the name of a phase, as shown to the user.
+     *
+     * @param phase The timed phase.
+     * @return const char* The phase name.
+     */
+    const char* FrameProfile::phaseName( Phase phase ){
+        switch( phase ){
+            case Phase::UpdateEntities:
+                return "updateEntities";
+            case Phase::GameRules:
+                return "gameRules";
+            case Phase::PackWidgets:
+                return "packWidgets";
+            case Phase::DrawEntities:
+                return "drawEntities";
+            case Phase::Display:
+                return "display";
+            default:
+                return "inputLatency";
+        }
+    }
+}
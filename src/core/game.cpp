@@ -0,0 +1,88 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file game.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/game.hpp>
+#include <core/types.hpp>
+#include <core/board.hpp>
+
+// STD
+#include <algorithm>
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     Game (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the Game class. The snake starts in the lower part of the board, moving up, with its whole body inside the board.
+     *
+     * @param board The board on which the game is played.
+     * @param seed The seed of the game random engine. The same seed and inputs always give the same game.
+     */
+    Game::Game( const Board& board, uint64_t seed ):
+        seed( seed ),
+        board( board ),
+        random( seed ),
+        snake( board, { board.width / 2, std::min<int32_t>( board.height * 3 / 4, board.height - start_length ) }, Direction::Up, start_length ),
+        food( snake.occupied(), random ){
+
+    }
+
+    //====================================================
+    //     step
+    //====================================================
+    /**
+     * @brief Method used to advance the simulation by one tick.
+     *
+     * @param input The input received during the tick.
+     * @return StepResult What happened during the tick.
+     */
+    StepResult Game::step( Input input ){
+        StepResult result;
+        if( ! this -> alive ){
+            return result;
+        }
+
+        // Change direction
+        if( input != Input::None ){
+            this -> snake.turn( toDirection( input ) );
+        }
+
+        // Check for collisions among snake and the board border or its body (the tail moves away unless growing)
+        const Cell next_head = this -> snake.nextHead();
+        result.ate_food = next_head == this -> food.position;
+        if( this -> snake.collides( next_head, ! result.ate_food ) ){
+            this -> alive = false;
+            result.died = true;
+            return result;
+        }
+
+        // Move snake and eat food
+        this -> snake.advance( result.ate_food );
+        if( result.ate_food ){
+            this -> score += 1;
+
+            // The snake fills the whole board
+            if( ! this -> food.respawn( this -> snake.occupied(), this -> random ) ){
+                this -> alive = false;
+                result.won = true;
+            }
+        }
+        this -> ticks += 1;
+
+        return result;
+    }
+}
@@ -0,0 +1,198 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file game_files.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/game_files.hpp>
+
+// System
+#ifdef _WIN32
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+// STD
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <iomanip>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <istream>
+#include <utility>
+
+namespace snake::core{
+
+    //====================================================
+    //     readScores
+    //====================================================
+    /**
+     * @brief Function used to read the rows of the scores file. Rows which do not start with a score are skipped.
+     *
+     * @param input The considered input stream.
+     * @return std::vector<ScoreEntry> The scores, in file order.
+     */
+    std::vector<ScoreEntry> readScores( std::istream& input ){
+
+        // Read scores from file
+        std::string score_line;
+        std::vector<std::string> lines;
+        while( std::getline( input, score_line ) ){
+            lines.push_back( score_line );
+        }
+
+        // Parse rows
+        std::vector<ScoreEntry> scores;
+        for( const auto& line: lines ){
+            std::stringstream words( line );
+            ScoreEntry entry{ 0, "" };
+            if( words >> entry.score ){
+                words >> entry.player;
+                scores.push_back( std::move( entry ) );
+            }
+        }
+
+        return scores;
+    }
+
+    //====================================================
+    //     writeFileAtomically
+    //====================================================
+    /**
+     * @brief Function used to replace the content of a file so that, even after a crash or a power loss, the file holds either the old or the new content. The content is written and synced to a temporary file, which is then renamed over the original one.
+     *
+     * @param path The file path.
+     * @param content The new content.
+     * @return true If the file has been replaced.
+     * @return false Otherwise, in which case the file is unchanged.
+     */
+    bool writeFileAtomically( const std::filesystem::path& path, std::string_view content ){
+        std::filesystem::path temporary_path = path;
+        temporary_path += ".tmp";
+
+        // Write and sync the temporary file
+        #ifdef _WIN32
+            std::FILE* file = _wfopen( temporary_path.c_str(), L"wb" );
+        #else
+            std::FILE* file = std::fopen( temporary_path.c_str(), "wb" );
+        #endif
+        if( file == nullptr ){
+            return false;
+        }
+        bool written = std::fwrite( content.data(), 1, content.size(), file ) == content.size() && std::fflush( file ) == 0;
+        #ifdef _WIN32
+            written = written && _commit( _fileno( file ) ) == 0;
+        #else
+            written = written && fsync( fileno( file ) ) == 0;
+        #endif
+        written = std::fclose( file ) == 0 && written;
+
+        // Replace the original file
+        std::error_code error;
+        if( written ){
+            std::filesystem::rename( temporary_path, path, error );
+        }
+        if( ! written || error ){
+            std::filesystem::remove( temporary_path, error );
+            return false;
+        }
+        return true;
+    }
+
+    //====================================================
+    //     moveAside
+    //====================================================
+    /**
+     * @brief Function used to rename a file which cannot be read, so that a new one can be created in its place without losing its content. The file gets the ".corrupt" suffix, replacing an older file moved aside.
+     *
+     * @param path The file path.
+     * @return true If the file has been moved.
+     * @return false Otherwise.
+     */
+    bool moveAside( const std::filesystem::path& path ){
+        std::filesystem::path corrupt_path = path;
+        corrupt_path += ".corrupt";
+
+        std::error_code error;
+        std::filesystem::remove( corrupt_path, error );
+        std::filesystem::rename( path, corrupt_path, error );
+        return ! error;
+    }
+
+    //====================================================
+    //     truncateUtf8
+    //====================================================
+    /**
+     * @brief Function used to cut a UTF-8 text to at most a number of bytes, without splitting a multi-byte character.
+     *
+     * @param text The text.
+     * @param size The maximum number of bytes.
+     * @return std::string_view The text, cut before the first character which does not fit.
+     */
+    std::string_view truncateUtf8( std::string_view text, size_t size ){
+        if( text.size() <= size ){
+            return text;
+        }
+        while( size > 0 && ( static_cast<uint8_t>( text[ size ] ) & 0xC0 ) == 0x80 ){
+            size--;
+        }
+        return text.substr( 0, size );
+    }
+
+    //====================================================
+    //     replayPath
+    //====================================================
+    /**
+     * @brief Function used to get the path of the replay of a game, e.g. "replay_000042.bin". Indexes are zero padded so that replays are listed in game order.
+     *
+     * @param directory The replays directory.
+     * @param index The index of the game.
+     * @return std::filesystem::path The replay path.
+     */
+    std::filesystem::path replayPath( const std::filesystem::path& directory, uint64_t index ){
+        std::ostringstream name;
+        name << "replay_" << std::setw( 6 ) << std::setfill( '0' ) << index << ".bin";
+        return directory / name.str();
+    }
+
+    //====================================================
+    //     nextReplayIndex
+    //====================================================
+    /**
+     * @brief Function used to get the index of the next replay, following the highest one found in the replays directory, so that no replay is overwritten.
+     *
+     * @param directory The replays directory.
+     * @return uint64_t The index of the next replay, 1 if there is none yet.
+     */
+    uint64_t nextReplayIndex( const std::filesystem::path& directory ){
+        uint64_t next = 1;
+        std::error_code error;
+        for( std::filesystem::directory_iterator entry( directory, error ), end; ! error && entry != end; entry.increment( error ) ){
+            const std::string name = entry -> path().filename().string();
+            if( name.size() <= 11 || name.compare( 0, 7, "replay_" ) != 0 || name.compare( name.size() - 4, 4, ".bin" ) != 0 ){
+                continue;
+            }
+            const std::string digits = name.substr( 7, name.size() - 11 );
+            if( digits.find_first_not_of( "0123456789" ) == std::string::npos && digits.size() < 20 ){
+                next = std::max<uint64_t>( next, std::stoull( digits ) + 1 );
+            }
+        }
+        return next;
+    }
+}
@@ -0,0 +1,153 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file input_queue.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/input_queue.hpp>
+#include <core/types.hpp>
+
+// STD
+#include <algorithm>
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     push
+    //====================================================
+    /**
+     * @brief Method used to queue a turn. The turn is compared with the last queued one, or with the snake heading if the queue is empty, and dropped if it would not change anything or would reverse the snake.
+     *
+     * @param input The pressed turn.
+     * @param heading The current direction of the snake.
+     * @param time The time at which the turn has been pressed, in seconds.
+     * @return true If the turn has been queued.
+     * @return false If it has been filtered out or the queue is full.
+     */
+    bool InputQueue::push( Input input, Direction heading, double time ){
+        if( input == Input::None || this -> count == capacity ){
+            return false;
+        }
+
+        // Filter against the direction the snake will have when this turn is consumed
+        const Direction reference = this -> count == 0 ? heading :
+            toDirection( this -> entries[ ( this -> front + this -> count - 1 ) % capacity ].input );
+        const Direction direction = toDirection( input );
+        if( direction == reference || isOpposite( direction, reference ) ){
+            return false;
+        }
+
+        this -> entries[ ( this -> front + this -> count ) % capacity ] = { input, time };
+        ++this -> count;
+        return true;
+    }
+
+    //====================================================
+    //     pop
+    //====================================================
+    /**
+     * @brief Method used to take the oldest queued turn for the current tick, recording how long it waited.
+     *
+     * @param time The time of the tick, in seconds.
+     * @return Input The oldest turn, or Input::None if the queue is empty.
+     */
+    Input InputQueue::pop( double time ){
+        if( this -> count == 0 ){
+            return Input::None;
+        }
+        const Entry& entry = this -> entries[ this -> front ];
+        this -> front = ( this -> front + 1 ) % capacity;
+        --this -> count;
+
+        // Event-to-tick latency
+        const double latency = std::max( time - entry.time, 0.0 );
+        ++this -> latency_samples;
+        this -> latency_total += latency;
+        this -> latency_max = std::max( this -> latency_max, latency );
+        this -> latency_last = latency;
+
+        return entry.input;
+    }
+
+    //====================================================
+    //     clear
+    //====================================================
+    /**
+     * @brief Method used to drop every queued turn, e.g. after a pause.
+     *
+     */
+    void InputQueue::clear(){
+        this -> front = 0;
+        this -> count = 0;
+    }
+
+    //====================================================
+    //     size
+    //====================================================
+    /**
+     * @brief Getter used to get the number of queued turns.
+     *
+     * @return uint32_t The number of queued turns.
+     */
+    uint32_t InputQueue::size() const {
+        return this -> count;
+    }
+
+    //====================================================
+    //     latencySamples
+    //====================================================
+    /**
+     * @brief Getter used to get the number of turns consumed so far.
+     *
+     * @return uint64_t The number of consumed turns.
+     */
+    uint64_t InputQueue::latencySamples() const {
+        return this -> latency_samples;
+    }
+
+    //====================================================
+    //     meanLatency
+    //====================================================
+    /**
+     * @brief Getter used to get the mean time between a turn being pressed and being consumed by a tick.
+     *
+     * @return double The mean latency, in seconds.
+     */
+    double InputQueue::meanLatency() const {
+        return this -> latency_samples == 0 ? 0.0 : this -> latency_total / this -> latency_samples;
+    }
+
+    //====================================================
+    //     lastLatency
+    //====================================================
+    /**
+     * @brief Getter used to get the time the last consumed turn waited before its tick.
+     *
+     * @return double The latency, in seconds, or 0 if no turn has been consumed.
+     */
+    double InputQueue::lastLatency() const {
+        return this -> latency_last;
+    }
+
+    //====================================================
+    //     maxLatency
+    //====================================================
+    /**
+     * @brief Getter used to get the longest time between a turn being pressed and being consumed by a tick.
+     *
+     * @return double The maximum latency, in seconds.
+     */
+    double InputQueue::maxLatency() const {
+        return this -> latency_max;
+    }
+}
@@ -0,0 +1,126 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file io_worker.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/io_worker.hpp>
+#include <core/trace.hpp>
+
+// STD
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace snake::core{
+
+    //====================================================
+    //     IoWorker (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the IoWorker class. The worker thread is started by the first posted task, so that static workers do not run before the rest of the program is initialized.
+     *
+     * @param capacity The maximum number of tasks waiting in the queue.
+     */
+    IoWorker::IoWorker( size_t capacity ):
+        capacity( capacity > 0 ? capacity : 1 ){}
+
+    //====================================================
+    //     IoWorker (destructor)
+    //====================================================
+    /**
+     * @brief Destructor of the IoWorker class. Tasks still in the queue are run before the thread is joined.
+     *
+     */
+    IoWorker::~IoWorker(){
+        {
+            const std::lock_guard<std::mutex> lock( this -> mutex );
+            this -> stopping = true;
+        }
+        this -> task_posted.notify_all();
+        if( this -> thread.joinable() ){
+            this -> thread.join();
+        }
+    }
+
+    //====================================================
+    //     post
+    //====================================================
+    /**
+     * @brief Method used to queue a task, waiting for room if the queue is full. The task must own, or outlive, whatever it writes.
+     *
+     * @param task The task.
+     */
+    void IoWorker::post( std::function<void()> task ){
+        std::unique_lock<std::mutex> lock( this -> mutex );
+        this -> task_done.wait( lock, [ this ](){ return this -> tasks.size() < this -> capacity; } );
+        this -> tasks.push_back( std::move( task ) );
+        if( ! this -> thread.joinable() ){
+            this -> thread = std::thread( [ this ](){ this -> run(); } );
+        }
+        lock.unlock();
+        this -> task_posted.notify_one();
+    }
+
+    //====================================================
+    //     flush
+    //====================================================
+    /**
+     * @brief Method used to wait until every posted task has been run, e.g. before reading files they write.
+     *
+     */
+    void IoWorker::flush(){
+        SNAKE_TRACE_SCOPE( "IoWorker::flush" );
+        std::unique_lock<std::mutex> lock( this -> mutex );
+        this -> task_done.wait( lock, [ this ](){ return this -> tasks.empty() && ! this -> busy; } );
+    }
+
+    //====================================================
+    //     run
+    //====================================================
+    /**
+     * @brief Method run by the worker thread, which runs the tasks in posting order until the worker is destroyed and the queue is empty.
+     *
+     */
+    void IoWorker::run(){
+        SNAKE_TRACE_THREAD( "io" );
+        std::unique_lock<std::mutex> lock( this -> mutex );
+        while( true ){
+            this -> task_posted.wait( lock, [ this ](){ return ! this -> tasks.empty() || this -> stopping; } );
+            if( this -> tasks.empty() ){
+                return;
+            }
+            std::function<void()> task = std::move( this -> tasks.front() );
+            this -> tasks.pop_front();
+            this -> busy = true;
+            lock.unlock();
+
+            // A failed write is reported, and must not stop the following ones
+            try{
+                SNAKE_TRACE_SCOPE( "IoWorker::task" );
+                task();
+            }
+            catch( const std::exception& exception ){
+                std::cerr << "I/O task failed: " << exception.what() << "\n";
+            }
+
+            lock.lock();
+            this -> busy = false;
+            this -> task_done.notify_all();
+        }
+    }
+}
@@ -0,0 +1,184 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file occupancy.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/occupancy.hpp>
+#include <core/types.hpp>
+#include <core/board.hpp>
+
+// STD
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     Occupancy (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the Occupancy class. All the board cells are free and the border cells are blocked.
+     *
+     * @param board The board to be mapped.
+     */
+    Occupancy::Occupancy( const Board& board ):
+        board( board ),
+        padded_width( board.width + 2 ),
+        words( ( static_cast<uint64_t>( board.width + 2 ) * ( board.height + 2 ) + 63 ) / 64, 0 ),
+        free_cells( board.size() ),
+        free_positions( board.size() ){
+
+        // Blocking the border
+        for( int32_t x = -1; x <= board.width; x++ ){
+            this -> setBit( this -> slot( { x, -1 } ) );
+            this -> setBit( this -> slot( { x, board.height } ) );
+        }
+        for( int32_t y = 0; y < board.height; y++ ){
+            this -> setBit( this -> slot( { -1, y } ) );
+            this -> setBit( this -> slot( { board.width, y } ) );
+        }
+
+        // Every board cell is free
+        for( uint32_t i = 0; i < board.size(); i++ ){
+            this -> free_cells[ i ] = i;
+            this -> free_positions[ i ] = i;
+        }
+    }
+
+    //====================================================
+    //     set
+    //====================================================
+    /**
+     * @brief Method used to mark a board cell as blocked, removing it from the free cells. Cells outside the board are ignored, so that walls are never changed.
+     *
+     * @param cell The cell.
+     */
+    void Occupancy::set( const Cell& cell ){
+        if( ! this -> board.contains( cell ) ){
+            return;
+        }
+        const uint32_t index = this -> slot( cell );
+        if( ( this -> words[ index >> 6 ] >> ( index & 63 ) ) & 1 ){
+            return;
+        }
+        this -> setBit( index );
+
+        // Swap the cell with the last free one and drop it
+        const uint32_t board_index = this -> board.index( cell );
+        const uint32_t position = this -> free_positions[ board_index ];
+        const uint32_t last = this -> free_cells.back();
+        this -> free_cells[ position ] = last;
+        this -> free_positions[ last ] = position;
+        this -> free_cells.pop_back();
+    }
+
+    //====================================================
+    //     reset
+    //====================================================
+    /**
+     * @brief Method used to mark a board cell as free, adding it to the free cells. Cells outside the board are ignored, so that walls are never changed.
+     *
+     * @param cell The cell.
+     */
+    void Occupancy::reset( const Cell& cell ){
+        if( ! this -> board.contains( cell ) ){
+            return;
+        }
+        const uint32_t index = this -> slot( cell );
+        if( ! ( ( this -> words[ index >> 6 ] >> ( index & 63 ) ) & 1 ) ){
+            return;
+        }
+        this -> resetBit( index );
+
+        // Append the cell to the free ones
+        const uint32_t board_index = this -> board.index( cell );
+        this -> free_positions[ board_index ] = static_cast<uint32_t>( this -> free_cells.size() );
+        this -> free_cells.push_back( board_index );
+    }
+
+    //====================================================
+    //     test
+    //====================================================
+    /**
+     * @brief Method used to check if a cell is blocked.
+     *
+     * @param cell The cell, inside the board or on its border.
+     * @return true If the cell is blocked by a wall or by the snake.
+     * @return false Otherwise.
+     */
+    bool Occupancy::test( const Cell& cell ) const {
+        const uint32_t index = this -> slot( cell );
+        return ( this -> words[ index >> 6 ] >> ( index & 63 ) ) & 1;
+    }
+
+    //====================================================
+    //     freeCount
+    //====================================================
+    /**
+     * @brief Getter used to get the number of free board cells.
+     *
+     * @return uint32_t The number of free cells.
+     */
+    uint32_t Occupancy::freeCount() const {
+        return static_cast<uint32_t>( this -> free_cells.size() );
+    }
+
+    //====================================================
+    //     freeCell
+    //====================================================
+    /**
+     * @brief Getter used to get a free cell by its position in the free cells set. The order is arbitrary.
+     *
+     * @param index The position in the free cells set, lower than freeCount().
+     * @return Cell The free cell.
+     */
+    Cell Occupancy::freeCell( uint32_t index ) const {
+        return this -> board.cell( this -> free_cells[ index ] );
+    }
+
+    //====================================================
+    //     slot
+    //====================================================
+    /**
+     * @brief Method used to get the bit index of a cell in the padded grid.
+     *
+     * @param cell The cell, inside the board or on its border.
+     * @return uint32_t The bit index.
+     */
+    uint32_t Occupancy::slot( const Cell& cell ) const {
+        return static_cast<uint32_t>( ( cell.y + 1 ) * this -> padded_width + ( cell.x + 1 ) );
+    }
+
+    //====================================================
+    //     setBit
+    //====================================================
+    /**
+     * @brief Method used to set a bit of the padded grid.
+     *
+     * @param index The bit index.
+     */
+    void Occupancy::setBit( uint32_t index ){
+        this -> words[ index >> 6 ] |= uint64_t{ 1 } << ( index & 63 );
+    }
+
+    //====================================================
+    //     resetBit
+    //====================================================
+    /**
+     * @brief Method used to reset a bit of the padded grid.
+     *
+     * @param index The bit index.
+     */
+    void Occupancy::resetBit( uint32_t index ){
+        this -> words[ index >> 6 ] &= ~( uint64_t{ 1 } << ( index & 63 ) );
+    }
+}
@@ -0,0 +1,202 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file options.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/options.hpp>
+#include <core/game_files.hpp>
+
+// STD
+#include <charconv>
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <istream>
+#include <ostream>
+
+namespace snake::core{
+
+    //====================================================
+    //     firstWord
+    //====================================================
+    /**
+     * @brief Function used to get the first word of a text. Option values are single words, as in the original options file format.
+     *
+     * @param text The text.
+     * @return std::string_view The first word, or an empty view if the text is blank.
+     */
+    static std::string_view firstWord( std::string_view text ){
+        constexpr std::string_view blanks{ " \t\r\n" };
+        const size_t begin = text.find_first_not_of( blanks );
+        if( begin == std::string_view::npos ){
+            return {};
+        }
+        text.remove_prefix( begin );
+        return text.substr( 0, text.find_first_of( blanks ) );
+    }
+
+    //====================================================
+    //     parse
+    //====================================================
+    /**
+     * @brief Method used to read the options from the rows of an options file. Rows are matched by key, so their order does not matter, and unknown rows are skipped.
+     *
+     * @param input The options file stream.
+     * @return Options The options.
+     */
+    Options Options::parse( std::istream& input ){
+        Options options;
+        std::string line;
+        while( std::getline( input, line ) ){
+            const std::string_view row{ line };
+            const std::string_view key = firstWord( row );
+            if( key.empty() ){
+                continue;
+            }
+            const std::string_view value = row.substr( key.data() - row.data() + key.size() );
+            if( key == "Player:" ){
+                options.setPlayer( value );
+            }
+            else if( key == "SpeedPlus:" ){
+                options.setSpeed( value );
+            }
+            else if( key == "Background:" ){
+                options.setBackground( value );
+            }
+            else if( key == "Seed:" ){
+                options.setSeed( value );
+            }
+        }
+        return options;
+    }
+
+    //====================================================
+    //     write
+    //====================================================
+    /**
+     * @brief Method used to write the options in the options file format.
+     *
+     * @param output The stream to which the options are written.
+     */
+    void Options::write( std::ostream& output ) const {
+        output << "Player: " << this -> player << "\n"
+               << "SpeedPlus: " << this -> speed << "\n"
+               << "Background: " << this -> background << "\n"
+               << "Seed: " << ( this -> seed ? std::to_string( *this -> seed ) : "random" ) << "\n";
+    }
+
+    //====================================================
+    //     save
+    //====================================================
+    /**
+     * @brief Method used to replace the options file with the options, atomically.
+     *
+     * @param path The options file path.
+     * @return true If the file has been written.
+     * @return false Otherwise, in which case the previous file is kept.
+     */
+    bool Options::save( const std::filesystem::path& path ) const {
+        std::ostringstream output;
+        this -> write( output );
+        return writeFileAtomically( path, output.str() );
+    }
+
+    //====================================================
+    //     setPlayer
+    //====================================================
+    /**
+     * @brief Method used to set the player name.
+     *
+     * @param value The text given for the option; its first word is used.
+     * @return true If the value is valid.
+     * @return false If it is blank, in which case the option is unchanged.
+     */
+    bool Options::setPlayer( std::string_view value ){
+        const std::string_view word = firstWord( value );
+        if( word.empty() ){
+            return false;
+        }
+        this -> player = word;
+        return true;
+    }
+
+    //====================================================
+    //     setSpeed
+    //====================================================
+    /**
+     * @brief Method used to set the snake speed, where the default speed is 25.
+     *
+     * @param value The text given for the option; its first word is used.
+     * @return true If the value is a positive integer.
+     * @return false Otherwise, in which case the option is unchanged.
+     */
+    bool Options::setSpeed( std::string_view value ){
+        const std::string_view word = firstWord( value );
+        int32_t speed = 0;
+        const auto result = std::from_chars( word.data(), word.data() + word.size(), speed );
+        if( result.ec != std::errc() || result.ptr != word.data() + word.size() || speed <= 0 ){
+            return false;
+        }
+        this -> speed = speed;
+        return true;
+    }
+
+    //====================================================
+    //     setBackground
+    //====================================================
+    /**
+     * @brief Method used to set the path of the game background image, or "default".
+     *
+     * @param value The text given for the option; its first word is used.
+     * @return true If the value is valid.
+     * @return false If it is blank, in which case the option is unchanged.
+     */
+    bool Options::setBackground( std::string_view value ){
+        const std::string_view word = firstWord( value );
+        if( word.empty() ){
+            return false;
+        }
+        this -> background = word;
+        return true;
+    }
+
+    //====================================================
+    //     setSeed
+    //====================================================
+    /**
+     * @brief Method used to set the seed of the games, or "random" to draw a new one for each game.
+     *
+     * @param value The text given for the option; its first word is used.
+     * @return true If the value is "random" or an unsigned integer.
+     * @return false Otherwise, in which case the option is unchanged.
+     */
+    bool Options::setSeed( std::string_view value ){
+        const std::string_view word = firstWord( value );
+        if( word == "random" ){
+            this -> seed.reset();
+            return true;
+        }
+        uint64_t seed = 0;
+        const auto result = std::from_chars( word.data(), word.data() + word.size(), seed );
+        if( result.ec != std::errc() || result.ptr != word.data() + word.size() ){
+            return false;
+        }
+        this -> seed = seed;
+        return true;
+    }
+}
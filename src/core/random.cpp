@@ -0,0 +1,98 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file random.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/random.hpp>
+
+// STD
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     rotl
+    //====================================================
+    /**
+     * @brief Function used to rotate the bits of a number to the left.
+     *
+     * @param x The number to be rotated.
+     * @param k The number of bits.
+     * @return uint64_t The rotated number.
+     */
+    static constexpr uint64_t rotl( uint64_t x, int k ){
+        return ( x << k ) | ( x >> ( 64 - k ) );
+    }
+
+    //====================================================
+    //     Random (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the Random class. The engine state is expanded from the seed with splitmix64.
+     *
+     * @param seed The seed of the sequence.
+     */
+    Random::Random( uint64_t seed ){
+        for( auto& word: this -> state ){
+            seed += 0x9E3779B97F4A7C15ull;
+            uint64_t z = seed;
+            z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+            z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+            word = z ^ ( z >> 31 );
+        }
+    }
+
+    //====================================================
+    //     next
+    //====================================================
+    /**
+     * @brief Method used to get the next 64 random bits.
+     *
+     * @return uint64_t The random bits.
+     */
+    uint64_t Random::next(){
+        const uint64_t result = rotl( this -> state[1] * 5, 7 ) * 9;
+        const uint64_t t = this -> state[1] << 17;
+
+        this -> state[2] ^= this -> state[0];
+        this -> state[3] ^= this -> state[1];
+        this -> state[1] ^= this -> state[2];
+        this -> state[0] ^= this -> state[3];
+        this -> state[2] ^= t;
+        this -> state[3] = rotl( this -> state[3], 45 );
+
+        return result;
+    }
+
+    //====================================================
+    //     uniform
+    //====================================================
+    /**
+     * @brief Method used to get an unbiased random number in [0, bound), with Lemire's multiply-and-reject method.
+     *
+     * @param bound The exclusive upper bound, greater than 0.
+     * @return uint32_t The random number.
+     */
+    uint32_t Random::uniform( uint32_t bound ){
+        uint64_t product = ( this -> next() >> 32 ) * bound;
+        uint32_t low = static_cast<uint32_t>( product );
+        if( low < bound ){
+            const uint32_t threshold = -bound % bound;
+            while( low < threshold ){
+                product = ( this -> next() >> 32 ) * bound;
+                low = static_cast<uint32_t>( product );
+            }
+        }
+        return static_cast<uint32_t>( product >> 32 );
+    }
+}
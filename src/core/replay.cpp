@@ -0,0 +1,188 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file replay.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/replay.hpp>
+#include <core/types.hpp>
+#include <core/board.hpp>
+
+// STD
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <istream>
+#include <ostream>
+
+namespace snake::core{
+
+    //====================================================
+    //     Replay (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the Replay class. It creates an empty replay.
+     *
+     * @param board The board on which the game is played.
+     * @param seed The seed of the game random engine.
+     */
+    Replay::Replay( const Board& board, uint64_t seed ):
+        board( board ),
+        seed( seed ){
+
+    }
+
+    //====================================================
+    //     record
+    //====================================================
+    /**
+     * @brief Method used to record the input given to a simulation tick. Empty inputs are not stored, since the game replays them implicitly.
+     *
+     * @param tick The tick to which the input has been given.
+     * @param input The input.
+     */
+    void Replay::record( uint64_t tick, Input input ){
+        if( input != Input::None ){
+            this -> events.push_back( { tick, input } );
+        }
+    }
+
+    //====================================================
+    //     next
+    //====================================================
+    /**
+     * @brief Method used to get the recorded input of a tick during playback. Ticks must be asked in increasing order.
+     *
+     * @param tick The tick being played.
+     * @return Input The recorded input, or Input::None if nothing has been recorded for that tick.
+     */
+    Input Replay::next( uint64_t tick ){
+        if( this -> cursor < this -> events.size() && this -> events[ this -> cursor ].tick == tick ){
+            return this -> events[ this -> cursor++ ].input;
+        }
+        return Input::None;
+    }
+
+    //====================================================
+    //     save
+    //====================================================
+    /**
+     * @brief Method used to write the replay in its binary format: a header with the board size and the seed, followed by one varint per input packing the tick delta from the previous input with the new direction. A turn costs one byte unless more than 31 ticks passed since the previous one.
+     *
+     * @param output The stream to which the replay is written.
+     */
+    void Replay::save( std::ostream& output ) const {
+        output.write( magic, sizeof( magic ) );
+        output.put( static_cast<char>( version ) );
+        writeVarint( output, static_cast<uint64_t>( this -> board.width ) );
+        writeVarint( output, static_cast<uint64_t>( this -> board.height ) );
+        for( uint32_t byte = 0; byte < 8; ++byte ){
+            output.put( static_cast<char>( this -> seed >> ( 8 * byte ) ) );
+        }
+        writeVarint( output, this -> events.size() );
+
+        uint64_t previous_tick = 0;
+        for( const auto& event: this -> events ){
+            const uint64_t direction = static_cast<uint8_t>( toDirection( event.input ) );
+            writeVarint( output, ( event.tick - previous_tick ) << 2 | direction );
+            previous_tick = event.tick;
+        }
+    }
+
+    //====================================================
+    //     load
+    //====================================================
+    /**
+     * @brief Method used to read a replay written by Replay::save.
+     *
+     * @param input The stream from which the replay is read.
+     * @return Replay The loaded replay, ready for playback.
+     */
+    Replay Replay::load( std::istream& input ){
+        char header[ sizeof( magic ) ]{};
+        input.read( header, sizeof( header ) );
+        if( ! input || ! std::equal( std::begin( header ), std::end( header ), std::begin( magic ) ) || input.get() != version ){
+            throw std::runtime_error( "The replay file is not valid!" );
+        }
+        const auto width = static_cast<int32_t>( readVarint( input ) );
+        const auto height = static_cast<int32_t>( readVarint( input ) );
+        uint64_t seed = 0;
+        for( uint32_t byte = 0; byte < 8; ++byte ){
+            seed |= static_cast<uint64_t>( static_cast<uint8_t>( input.get() ) ) << ( 8 * byte );
+        }
+
+        Replay replay( Board( width, height ), seed );
+        const uint64_t count = readVarint( input );
+        uint64_t tick = 0;
+        for( uint64_t i = 0; i < count; ++i ){
+            const uint64_t value = readVarint( input );
+            tick += value >> 2;
+            replay.events.push_back( { tick, static_cast<Input>( ( value & 3 ) + 1 ) } );
+        }
+        return replay;
+    }
+
+    //====================================================
+    //     size
+    //====================================================
+    /**
+     * @brief Getter used to get the number of recorded inputs.
+     *
+     * @return size_t The number of recorded inputs.
+     */
+    size_t Replay::size() const {
+        return this -> events.size();
+    }
+
+    //====================================================
+    //     writeVarint
+    //====================================================
+    /**
+     * @brief Method used to write an unsigned integer 7 bits per byte, with the high bit marking that more bytes follow.
+     *
+     * @param output The stream to which the value is written.
+     * @param value The value to be written.
+     */
+    void Replay::writeVarint( std::ostream& output, uint64_t value ){
+        while( value >= 0x80 ){
+            output.put( static_cast<char>( ( value & 0x7F ) | 0x80 ) );
+            value >>= 7;
+        }
+        output.put( static_cast<char>( value ) );
+    }
+
+    //====================================================
+    //     readVarint
+    //====================================================
+    /**
+     * @brief Method used to read an unsigned integer written by Replay::writeVarint.
+     *
+     * @param input The stream from which the value is read.
+     * @return uint64_t The read value.
+     */
+    uint64_t Replay::readVarint( std::istream& input ){
+        uint64_t value = 0;
+        for( uint32_t shift = 0; shift < 64; shift += 7 ){
+            const int byte = input.get();
+            if( byte == std::istream::traits_type::eof() ){
+                throw std::runtime_error( "The replay file is truncated!" );
+            }
+            value |= static_cast<uint64_t>( byte & 0x7F ) << shift;
+            if( ( byte & 0x80 ) == 0 ){
+                return value;
+            }
+        }
+        throw std::runtime_error( "The replay file is not valid!" );
+    }
+}
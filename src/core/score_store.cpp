@@ -0,0 +1,310 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file score_store.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/score_store.hpp>
+#include <core/binary_io.hpp>
+#include <core/game_files.hpp>
+
+// STD
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     open
+    //====================================================
+    /**
+     * @brief Method used to open a store, creating it if the file does not exist. Only the header is read, unless it has been left inconsistent by an interrupted append, in which case it is rebuilt from the records. A file which is not a store is moved aside and replaced by a new store.
+     *
+     * @param path The store file path.
+     * @return true If the store has been opened.
+     * @return false If the file cannot be created or moved aside; appends are then ignored.
+     */
+    bool ScoreStore::open( const std::filesystem::path& path ){
+        this -> file_path.clear();
+        this -> count = 0;
+        this -> best_score = 0;
+        this -> top_scores.clear();
+
+        // Create an empty store
+        std::error_code error;
+        if( ! std::filesystem::exists( path, error ) ){
+            std::ofstream output( path, std::ios::binary );
+            this -> writeHeader( output );
+            if( ! output ){
+                return false;
+            }
+            this -> file_path = path;
+            return true;
+        }
+
+        // Keep a file which is not a store, and start a new one
+        std::array<char, header_size> header;
+        std::ifstream input( path, std::ios::binary );
+        input.read( header.data(), header.size() );
+        const bool complete = static_cast<bool>( input );
+        input.close();
+        if( ! complete || ! isStore( header.data() ) ){
+            return moveAside( path ) && this -> open( path );
+        }
+
+        // Check the header against the file size
+        const uint64_t file_size = std::filesystem::file_size( path, error );
+        if( error ){
+            return false;
+        }
+        this -> file_path = path;
+        const uint64_t records = ( file_size - header_size ) / record_size;
+        if( ! this -> readHeader( header.data() ) || records != this -> count || file_size != header_size + records * record_size ){
+            return this -> rebuild( records );
+        }
+        return true;
+    }
+
+    //====================================================
+    //     append
+    //====================================================
+    /**
+     * @brief Method used to add a game to the store.
+     *
+     * @param entry The score and the player of the game.
+     * @return true If the game has been written.
+     * @return false Otherwise.
+     */
+    bool ScoreStore::append( const ScoreEntry& entry ){
+        return this -> append( std::vector<ScoreEntry>{ entry } );
+    }
+
+    //====================================================
+    //     append
+    //====================================================
+    /**
+     * @brief Method used to add several games to the store, writing the header once. Records are written before the header, so that an interrupted append is recovered when the store is opened again.
+     *
+     * @param entries The scores and the players of the games, in play order.
+     * @return true If the games have been written.
+     * @return false Otherwise.
+     */
+    bool ScoreStore::append( const std::vector<ScoreEntry>& entries ){
+        if( this -> file_path.empty() ){
+            return false;
+        }
+
+        std::fstream file( this -> file_path, std::ios::in | std::ios::out | std::ios::binary );
+        file.seekp( static_cast<std::streamoff>( header_size + this -> count * record_size ) );
+        for( const auto& entry: entries ){
+            writeRecord( file, entry );
+            this -> count++;
+            this -> best_score = std::max( this -> best_score, entry.score );
+            this -> insertTop( entry );
+        }
+        file.seekp( 0 );
+        this -> writeHeader( file );
+
+        return static_cast<bool>( file.flush() );
+    }
+
+    //====================================================
+    //     top
+    //====================================================
+    /**
+     * @brief Getter used to get the best games, from the highest score. Games with the same score are in play order.
+     *
+     * @return const std::vector<ScoreEntry>& The best games, at most top_capacity.
+     */
+    const std::vector<ScoreEntry>& ScoreStore::top() const {
+        return this -> top_scores;
+    }
+
+    //====================================================
+    //     best
+    //====================================================
+    /**
+     * @brief Getter used to get the best score.
+     *
+     * @return uint64_t The best score, or 0 if no game has been played.
+     */
+    uint64_t ScoreStore::best() const {
+        return this -> best_score;
+    }
+
+    //====================================================
+    //     size
+    //====================================================
+    /**
+     * @brief Getter used to get the number of stored games.
+     *
+     * @return uint64_t The number of games.
+     */
+    uint64_t ScoreStore::size() const {
+        return this -> count;
+    }
+
+    //====================================================
+    //     insertTop
+    //====================================================
+    /**
+     * @brief Method used to insert a game among the best ones, if its score is high enough. It goes after the games with the same score, which have been played earlier.
+     *
+     * @param entry The game.
+     */
+    void ScoreStore::insertTop( const ScoreEntry& entry ){
+        const auto position = std::find_if( this -> top_scores.begin(), this -> top_scores.end(), [ &entry ]( const ScoreEntry& other ){
+            return other.score < entry.score;
+        } );
+        if( static_cast<size_t>( position - this -> top_scores.begin() ) >= top_capacity ){
+            return;
+        }
+        this -> top_scores.insert( position, entry );
+        if( this -> top_scores.size() > top_capacity ){
+            this -> top_scores.pop_back();
+        }
+    }
+
+    //====================================================
+    //     readHeader
+    //====================================================
+    /**
+     * @brief Method used to read the number of games, the best score and the best games from the header of the store.
+     *
+     * @param header The first byte of the header.
+     * @return true If the header is valid.
+     * @return false Otherwise, in which case it must be rebuilt.
+     */
+    bool ScoreStore::readHeader( const char* header ){
+        const char* data = header + sizeof( magic ) + 4;
+        const uint64_t top_count = readInteger( data + 16, 8 );
+        if( top_count > top_capacity ){
+            return false;
+        }
+        this -> count = readInteger( data, 8 );
+        this -> best_score = readInteger( data + 8, 8 );
+        for( uint64_t i = 0; i < top_count; ++i ){
+            this -> top_scores.push_back( readRecord( data + 24 + i * record_size ) );
+        }
+        return true;
+    }
+
+    //====================================================
+    //     isStore
+    //====================================================
+    /**
+     * @brief Method used to check the magic and the version of a store header.
+     *
+     * @param header The first byte of the header.
+     * @return true If the file is a store of this version.
+     * @return false Otherwise.
+     */
+    bool ScoreStore::isStore( const char* header ){
+        return std::equal( std::begin( magic ), std::end( magic ), header ) && static_cast<uint8_t>( header[ sizeof( magic ) ] ) == version;
+    }
+
+    //====================================================
+    //     writeHeader
+    //====================================================
+    /**
+     * @brief Method used to write the header of the store. Unused best game slots are zeroed, so that the header size is fixed.
+     *
+     * @param output The stream to which the header is written.
+     */
+    void ScoreStore::writeHeader( std::ostream& output ) const {
+        output.write( magic, sizeof( magic ) );
+        output.put( static_cast<char>( version ) );
+        writeInteger( output, 0, 3 );
+        writeInteger( output, this -> count, 8 );
+        writeInteger( output, this -> best_score, 8 );
+        writeInteger( output, this -> top_scores.size(), 8 );
+        for( uint32_t i = 0; i < top_capacity; ++i ){
+            writeRecord( output, i < this -> top_scores.size() ? this -> top_scores[ i ] : ScoreEntry{ 0, "" } );
+        }
+    }
+
+    //====================================================
+    //     rebuild
+    //====================================================
+    /**
+     * @brief Method used to recompute the header from the complete records, dropping a partially written one.
+     *
+     * @param records The number of complete records in the file.
+     * @return true If the store has been repaired.
+     * @return false Otherwise.
+     */
+    bool ScoreStore::rebuild( uint64_t records ){
+        this -> count = 0;
+        this -> best_score = 0;
+        this -> top_scores.clear();
+
+        std::ifstream input( this -> file_path, std::ios::binary );
+        input.seekg( static_cast<std::streamoff>( header_size ) );
+        std::array<char, record_size> record;
+        for( uint64_t i = 0; i < records && input.read( record.data(), record.size() ); ++i ){
+            const ScoreEntry entry = readRecord( record.data() );
+            this -> count++;
+            this -> best_score = std::max( this -> best_score, entry.score );
+            this -> insertTop( entry );
+        }
+        input.close();
+
+        std::error_code error;
+        std::filesystem::resize_file( this -> file_path, header_size + this -> count * record_size, error );
+        std::fstream file( this -> file_path, std::ios::in | std::ios::out | std::ios::binary );
+        this -> writeHeader( file );
+
+        return ! error && file.flush();
+    }
+
+    //====================================================
+    //     writeRecord
+    //====================================================
+    /**
+     * @brief Method used to write a game as a fixed size record: the score, followed by the player name padded with zeros. Longer names are cut on a character boundary.
+     *
+     * @param output The stream to which the record is written.
+     * @param entry The game.
+     */
+    void ScoreStore::writeRecord( std::ostream& output, const ScoreEntry& entry ){
+        std::array<char, player_size> player{};
+        const std::string_view name = truncateUtf8( entry.player, player_size );
+        std::copy( name.begin(), name.end(), player.begin() );
+        writeInteger( output, entry.score, 8 );
+        output.write( player.data(), player.size() );
+    }
+
+    //====================================================
+    //     readRecord
+    //====================================================
+    /**
+     * @brief Method used to read a game record.
+     *
+     * @param data The first byte of the record.
+     * @return ScoreEntry The game.
+     */
+    ScoreEntry ScoreStore::readRecord( const char* data ){
+        const char* player = data + 8;
+        return { readInteger( data, 8 ), std::string( player, std::find( player, player + player_size, '\0' ) ) };
+    }
+}
@@ -0,0 +1,218 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file snake.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/snake.hpp>
+#include <core/types.hpp>
+#include <core/board.hpp>
+#include <core/occupancy.hpp>
+
+// STD
+#include <algorithm>
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     Snake (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the Snake class. The body is laid behind the head, opposite to the movement direction.
+     *
+     * @param board The board on which the snake moves. Its size is the maximum snake length.
+     * @param head The starting head cell.
+     * @param direction The starting movement direction.
+     * @param length The starting length, head included.
+     */
+    Snake::Snake( const Board& board, const Cell& head, Direction direction, uint32_t length ):
+        direction( direction ),
+        last_direction( direction ),
+        occupancy( board ),
+        ring( board.size() ){
+
+        // Opposite direction used to lay the body
+        const auto behind = static_cast<Direction>( static_cast<uint8_t>( direction ) ^ 1 );
+
+        // Building the body
+        Cell piece = head;
+        this -> body_length = std::clamp<uint32_t>( length, 1, this -> capacity() );
+        for( uint32_t i = 0; i < this -> body_length; i++ ){
+            this -> ring[ i ] = piece;
+            this -> occupancy.set( piece );
+            piece = neighbour( piece, behind );
+        }
+        this -> previous_tail = this -> tail();
+    }
+
+    //====================================================
+    //     turn
+    //====================================================
+    /**
+     * @brief Method used to change the direction of the next movement. Reversing onto the body is ignored.
+     *
+     * @param new_direction The requested direction.
+     */
+    void Snake::turn( Direction new_direction ){
+        if( ! isOpposite( new_direction, this -> last_direction ) ){
+            this -> direction = new_direction;
+        }
+    }
+
+    //====================================================
+    //     advance
+    //====================================================
+    /**
+     * @brief Method used to move the snake by one cell along its direction. The new head is written in the slot before the old one: when not growing this is the old tail slot once the buffer is full, otherwise the tail is simply dropped by not increasing the length. The tail cell before the movement is kept in previous_tail, for interpolation.
+     *
+     * @param grow If true the tail is kept, making the snake one cell longer.
+     */
+    void Snake::advance( bool grow ){
+        this -> previous_tail = this -> tail();
+        const Cell next_head = this -> nextHead();
+
+        // Pop the tail, unless growing (freed first, since the head may enter the same cell)
+        if( grow && this -> body_length < this -> capacity() ){
+            this -> body_length += 1;
+        }
+        else{
+            this -> occupancy.reset( this -> previous_tail );
+        }
+
+        // Push the head
+        this -> head_index = ( this -> head_index == 0 ? this -> capacity() : this -> head_index ) - 1;
+        this -> ring[ this -> head_index ] = next_head;
+        this -> occupancy.set( next_head );
+        this -> last_direction = this -> direction;
+        this -> move_count += 1;
+    }
+
+    //====================================================
+    //     collides
+    //====================================================
+    /**
+     * @brief Method used to check if the head would collide by moving into a cell, either with the board border or with the body.
+     *
+     * @param cell The cell to be checked, inside the board or on its border.
+     * @param ignore_tail If true the tail cell is not considered, since it is going to be freed.
+     * @return true If the cell is blocked.
+     * @return false Otherwise.
+     */
+    bool Snake::collides( const Cell& cell, bool ignore_tail ) const {
+        if( ignore_tail && cell == this -> tail() ){
+            return false;
+        }
+        return this -> occupancy.test( cell );
+    }
+
+    //====================================================
+    //     nextHead
+    //====================================================
+    /**
+     * @brief Method used to get the cell which the head is going to reach at the next movement.
+     *
+     * @return Cell The next head cell.
+     */
+    Cell Snake::nextHead() const {
+        return neighbour( this -> head(), this -> direction );
+    }
+
+    //====================================================
+    //     head
+    //====================================================
+    /**
+     * @brief Getter used to get the head cell.
+     *
+     * @return const Cell& The head cell.
+     */
+    const Cell& Snake::head() const {
+        return this -> ring[ this -> head_index ];
+    }
+
+    //====================================================
+    //     tail
+    //====================================================
+    /**
+     * @brief Getter used to get the tail cell.
+     *
+     * @return const Cell& The tail cell.
+     */
+    const Cell& Snake::tail() const {
+        return this -> cell( this -> body_length - 1 );
+    }
+
+    //====================================================
+    //     cell
+    //====================================================
+    /**
+     * @brief Getter used to get a cell of the snake, counting from the head.
+     *
+     * @param index The index of the cell (0 is the head).
+     * @return const Cell& The requested cell.
+     */
+    const Cell& Snake::cell( uint32_t index ) const {
+        uint32_t slot = this -> head_index + index;
+        if( slot >= this -> capacity() ){
+            slot -= this -> capacity();
+        }
+        return this -> ring[ slot ];
+    }
+
+    //====================================================
+    //     occupied
+    //====================================================
+    /**
+     * @brief Getter used to get the occupancy map of the board, which also indexes the free cells.
+     *
+     * @return const Occupancy& The occupancy map.
+     */
+    const Occupancy& Snake::occupied() const {
+        return this -> occupancy;
+    }
+
+    //====================================================
+    //     length
+    //====================================================
+    /**
+     * @brief Getter used to get the snake length, head included.
+     *
+     * @return uint32_t The snake length.
+     */
+    uint32_t Snake::length() const {
+        return this -> body_length;
+    }
+
+    //====================================================
+    //     capacity
+    //====================================================
+    /**
+     * @brief Getter used to get the maximum snake length.
+     *
+     * @return uint32_t The snake capacity.
+     */
+    uint32_t Snake::capacity() const {
+        return static_cast<uint32_t>( this -> ring.size() );
+    }
+
+    //====================================================
+    //     moves
+    //====================================================
+    /**
+     * @brief Getter used to get the number of cells moved since the snake has been created, so that views can tell how many ticks passed since they last looked at it.
+     *
+     * @return uint64_t The number of moves.
+     */
+    uint64_t Snake::moves() const {
+        return this -> move_count;
+    }
+}
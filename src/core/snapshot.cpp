@@ -0,0 +1,180 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file snapshot.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/snapshot.hpp>
+#include <core/game.hpp>
+#include <core/snake.hpp>
+#include <core/types.hpp>
+
+// STD
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     SnakeView (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the SnakeView class. Its ring has the capacity of the snake, so that captures never allocate.
+     *
+     * @param snake The snake to be copied.
+     */
+    SnakeView::SnakeView( const Snake& snake ):
+        last_direction( snake.last_direction ),
+        previous_tail( snake.previous_tail ),
+        ring( snake.capacity() ){
+        this -> capture( snake );
+    }
+
+    //====================================================
+    //     capture
+    //====================================================
+    /**
+     * @brief Method used to bring the view up to date with the snake. The cells entered since the last capture are pushed on the head side, while the others are already in place; everything is copied again only if the snake moved farther than its length.
+     *
+     * @param snake The snake to be copied, the same one since the view has been created.
+     */
+    void SnakeView::capture( const Snake& snake ){
+        const uint64_t moved = snake.moves() - this -> move_count;
+        if( moved >= snake.length() || this -> body_length == 0 ){
+            this -> head_index = 0;
+            for( uint32_t i = 0; i < snake.length(); i++ ){
+                this -> ring[ i ] = snake.cell( i );
+            }
+        }
+        else{
+            for( uint32_t i = static_cast<uint32_t>( moved ); i > 0; i-- ){
+                this -> head_index = ( this -> head_index == 0 ? this -> capacity() : this -> head_index ) - 1;
+                this -> ring[ this -> head_index ] = snake.cell( i - 1 );
+            }
+        }
+        this -> body_length = snake.length();
+        this -> move_count = snake.moves();
+        this -> last_direction = snake.last_direction;
+        this -> previous_tail = snake.previous_tail;
+    }
+
+    //====================================================
+    //     head
+    //====================================================
+    /**
+     * @brief Getter used to get the head cell.
+     *
+     * @return const Cell& The head cell.
+     */
+    const Cell& SnakeView::head() const {
+        return this -> ring[ this -> head_index ];
+    }
+
+    //====================================================
+    //     tail
+    //====================================================
+    /**
+     * @brief Getter used to get the tail cell.
+     *
+     * @return const Cell& The tail cell.
+     */
+    const Cell& SnakeView::tail() const {
+        return this -> cell( this -> body_length - 1 );
+    }
+
+    //====================================================
+    //     cell
+    //====================================================
+    /**
+     * @brief Getter used to get a cell of the snake, counting from the head.
+     *
+     * @param index The index of the cell (0 is the head).
+     * @return const Cell& The requested cell.
+     */
+    const Cell& SnakeView::cell( uint32_t index ) const {
+        uint32_t slot = this -> head_index + index;
+        if( slot >= this -> capacity() ){
+            slot -= this -> capacity();
+        }
+        return this -> ring[ slot ];
+    }
+
+    //====================================================
+    //     length
+    //====================================================
+    /**
+     * @brief Getter used to get the snake length, head included.
+     *
+     * @return uint32_t The snake length.
+     */
+    uint32_t SnakeView::length() const {
+        return this -> body_length;
+    }
+
+    //====================================================
+    //     capacity
+    //====================================================
+    /**
+     * @brief Getter used to get the maximum snake length.
+     *
+     * @return uint32_t The snake capacity.
+     */
+    uint32_t SnakeView::capacity() const {
+        return static_cast<uint32_t>( this -> ring.size() );
+    }
+
+    //====================================================
+    //     moves
+    //====================================================
+    /**
+     * @brief Getter used to get the number of moves of the snake at the last capture.
+     *
+     * @return uint64_t The number of moves.
+     */
+    uint64_t SnakeView::moves() const {
+        return this -> move_count;
+    }
+
+    //====================================================
+    //     Snapshot (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the Snapshot struct, taken at the game start.
+     *
+     * @param game The game to be copied.
+     */
+    Snapshot::Snapshot( const Game& game ):
+        snake( game.snake ),
+        food( game.food.position ),
+        score( game.score ),
+        ticks( game.ticks ),
+        alive( game.alive ){
+
+    }
+
+    //====================================================
+    //     capture
+    //====================================================
+    /**
+     * @brief Method used to copy the current game state into the snapshot. Only the snake cells entered since the snapshot was last captured are copied, and storage is reused, so no allocation happens once the snapshot exists.
+     *
+     * @param game The game to be copied.
+     * @param tick_time The time at which the last simulated tick was due, in seconds.
+     */
+    void Snapshot::capture( const Game& game, double tick_time ){
+        this -> snake.capture( game.snake );
+        this -> food = game.food.position;
+        this -> score = game.score;
+        this -> ticks = game.ticks;
+        this -> alive = game.alive;
+        this -> time = tick_time;
+    }
+}
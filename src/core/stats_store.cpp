@@ -0,0 +1,259 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file stats_store.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/stats_store.hpp>
+#include <core/binary_io.hpp>
+#include <core/game_files.hpp>
+
+// STD
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     add
+    //====================================================
+    /**
+     * @brief Method used to add a game to the statistics of the player. The oldest of the last scores is replaced.
+     *
+     * @param game The game.
+     */
+    void PlayerStats::add( const GameStats& game ){
+        this -> recent_scores[ this -> games % recent_capacity ] = game.score;
+        this -> games++;
+        this -> best = std::max( this -> best, game.score );
+        this -> total_score += game.score;
+        this -> food += game.food;
+        this -> play_time += game.play_time;
+    }
+
+    //====================================================
+    //     mean
+    //====================================================
+    /**
+     * @brief Method used to get the mean score of the player.
+     *
+     * @return double The mean score, or 0 if no game has been played.
+     */
+    double PlayerStats::mean() const {
+        return this -> games > 0 ? static_cast<double>( this -> total_score ) / this -> games : 0.0;
+    }
+
+    //====================================================
+    //     recent
+    //====================================================
+    /**
+     * @brief Method used to get the last scores of the player.
+     *
+     * @return std::vector<uint64_t> The last scores, at most recent_capacity, from the oldest.
+     */
+    std::vector<uint64_t> PlayerStats::recent() const {
+        const uint64_t size = std::min<uint64_t>( this -> games, recent_capacity );
+        std::vector<uint64_t> scores;
+        scores.reserve( size );
+        for( uint64_t i = this -> games - size; i < this -> games; ++i ){
+            scores.push_back( this -> recent_scores[ i % recent_capacity ] );
+        }
+        return scores;
+    }
+
+    //====================================================
+    //     open
+    //====================================================
+    /**
+     * @brief Method used to open a store, which is created by the first added game if the file does not exist. A file which is not a valid store is moved aside, and games are added to a new store.
+     *
+     * @param path The store file path.
+     * @return true If the store has been opened.
+     * @return false If an invalid file cannot be moved aside; games are then not saved, so that it is kept.
+     */
+    bool StatsStore::open( const std::filesystem::path& path ){
+        this -> file_path = path;
+        this -> player_stats.clear();
+
+        std::error_code error;
+        if( ! std::filesystem::exists( path, error ) ){
+            return true;
+        }
+
+        // Read the whole file, which holds a record per player
+        std::ifstream input( path, std::ios::binary );
+        const std::string data{ std::istreambuf_iterator<char>( input ), std::istreambuf_iterator<char>() };
+        input.close();
+
+        // Keep a file which is not a store, and start a new one
+        if( ! isStore( data ) ){
+            if( ! moveAside( path ) ){
+                this -> file_path.clear();
+                return false;
+            }
+            return true;
+        }
+        const uint64_t count = readInteger( data.data() + sizeof( magic ) + 4, 8 );
+        for( uint64_t i = 0; i < count; ++i ){
+            PlayerStats stats = readRecord( data.data() + header_size + i * record_size );
+            this -> player_stats.emplace( stats.player, std::move( stats ) );
+        }
+        return true;
+    }
+
+    //====================================================
+    //     add
+    //====================================================
+    /**
+     * @brief Method used to add a game to the statistics of its player and save the store. Player names are cut as in the score store.
+     *
+     * @param game The game.
+     * @return true If the store has been saved.
+     * @return false Otherwise, in which case the previous file is kept.
+     */
+    bool StatsStore::add( const GameStats& game ){
+        const std::string player{ truncateUtf8( game.player, player_size ) };
+        auto& stats = this -> player_stats[ player ];
+        stats.player = player;
+        stats.add( game );
+        return this -> save();
+    }
+
+    //====================================================
+    //     find
+    //====================================================
+    /**
+     * @brief Getter used to get the statistics of a player.
+     *
+     * @param player The player name.
+     * @return const PlayerStats* The statistics, or nullptr if the player has not played yet.
+     */
+    const PlayerStats* StatsStore::find( const std::string& player ) const {
+        const auto stats = this -> player_stats.find( std::string( truncateUtf8( player, player_size ) ) );
+        return stats != this -> player_stats.end() ? &stats -> second : nullptr;
+    }
+
+    //====================================================
+    //     players
+    //====================================================
+    /**
+     * @brief Getter used to get the statistics of every player, by name.
+     *
+     * @return const std::unordered_map<std::string, PlayerStats>& The statistics.
+     */
+    const std::unordered_map<std::string, PlayerStats>& StatsStore::players() const {
+        return this -> player_stats;
+    }
+
+    //====================================================
+    //     save
+    //====================================================
+    /**
+     * @brief Method used to replace the store file with the statistics, atomically.
+     *
+     * @return true If the file has been written.
+     * @return false Otherwise.
+     */
+    bool StatsStore::save() const {
+        if( this -> file_path.empty() ){
+            return false;
+        }
+
+        std::ostringstream output;
+        output.write( magic, sizeof( magic ) );
+        output.put( static_cast<char>( version ) );
+        writeInteger( output, 0, 3 );
+        writeInteger( output, this -> player_stats.size(), 8 );
+        for( const auto& [ player, stats ]: this -> player_stats ){
+            writeRecord( output, stats );
+        }
+        return writeFileAtomically( this -> file_path, output.str() );
+    }
+
+    //====================================================
+    //     isStore
+    //====================================================
+    /**
+     * @brief Method used to check that a file is a valid store: magic, version and a size matching the number of players.
+     *
+     * @param data The file content.
+     * @return true If the file is a valid store.
+     * @return false Otherwise.
+     */
+    bool StatsStore::isStore( std::string_view data ){
+        if( data.size() < header_size || ! std::equal( std::begin( magic ), std::end( magic ), data.data() ) || static_cast<uint8_t>( data[ sizeof( magic ) ] ) != version ){
+            return false;
+        }
+        const uint64_t count = readInteger( data.data() + sizeof( magic ) + 4, 8 );
+        return count == ( data.size() - header_size ) / record_size && data.size() == header_size + count * record_size;
+    }
+
+    //====================================================
+    //     writeRecord
+    //====================================================
+    /**
+     * @brief Method used to write the statistics of a player as a fixed size record: the player name padded with zeros, the totals and the last scores.
+     *
+     * @param output The stream to which the record is written.
+     * @param stats The statistics.
+     */
+    void StatsStore::writeRecord( std::ostream& output, const PlayerStats& stats ){
+        std::array<char, player_size> player{};
+        const std::string_view name = truncateUtf8( stats.player, player_size );
+        std::copy( name.begin(), name.end(), player.begin() );
+        output.write( player.data(), player.size() );
+        for( const uint64_t value: { stats.games, stats.best, stats.total_score, stats.food, stats.play_time } ){
+            writeInteger( output, value, 8 );
+        }
+        for( const uint64_t score: stats.recent_scores ){
+            writeInteger( output, score, 8 );
+        }
+    }
+
+    //====================================================
+    //     readRecord
+    //====================================================
+    /**
+     * @brief Method used to read the statistics record of a player.
+     *
+     * @param data The first byte of the record.
+     * @return PlayerStats The statistics.
+     */
+    PlayerStats StatsStore::readRecord( const char* data ){
+        PlayerStats stats;
+        stats.player.assign( data, std::find( data, data + player_size, '\0' ) );
+        data += player_size;
+        for( uint64_t* value: { &stats.games, &stats.best, &stats.total_score, &stats.food, &stats.play_time } ){
+            *value = readInteger( data, 8 );
+            data += 8;
+        }
+        for( uint64_t& score: stats.recent_scores ){
+            score = readInteger( data, 8 );
+            data += 8;
+        }
+        return stats;
+    }
+}
@@ -0,0 +1,213 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file thread_pool.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/thread_pool.hpp>
+#include <core/trace.hpp>
+
+// STD
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     WorkStealingPool (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the WorkStealingPool class. It starts the workers, which wait for the first batch.
+     *
+     * @param threads The number of workers, or 0 to use every hardware thread.
+     */
+    WorkStealingPool::WorkStealingPool( uint32_t threads ):
+        threads( threads > 0 ? threads : std::max( std::thread::hardware_concurrency(), 1u ) ),
+        queues( this -> threads ){
+
+        this -> workers.reserve( this -> threads );
+        for( uint32_t worker = 0; worker < this -> threads; worker++ ){
+            this -> workers.emplace_back( [ this, worker ](){ this -> work( worker ); } );
+        }
+    }
+
+    //====================================================
+    //     WorkStealingPool (destructor)
+    //====================================================
+    /**
+     * @brief Destructor of the WorkStealingPool class. The last batch is finished before the workers are joined.
+     *
+     */
+    WorkStealingPool::~WorkStealingPool(){
+        this -> wait();
+        {
+            const std::lock_guard<std::mutex> lock( this -> mutex );
+            this -> stopping = true;
+        }
+        this -> batch_posted.notify_all();
+        for( auto& worker: this -> workers ){
+            worker.join();
+        }
+    }
+
+    //====================================================
+    //     post
+    //====================================================
+    /**
+     * @brief Method used to start a batch of tasks without waiting for it, once the previous batch is over. Tasks are dealt round robin to the workers.
+     *
+     * @param tasks The number of tasks, which the job receives as indexes from 0.
+     * @param job The job run for each task, with the index of the worker running it.
+     */
+    void WorkStealingPool::post( uint64_t tasks, std::function<void( uint32_t, uint64_t )> job ){
+        this -> wait();
+        if( tasks == 0 ){
+            return;
+        }
+
+        this -> job = std::move( job );
+        this -> remaining = tasks;
+        for( uint64_t task = 0; task < tasks; task++ ){
+            Queue& queue = this -> queues[ task % this -> threads ];
+            const std::lock_guard<std::mutex> lock( queue.mutex );
+            queue.tasks.push_back( task );
+        }
+        {
+            const std::lock_guard<std::mutex> lock( this -> mutex );
+            this -> batch++;
+        }
+        this -> batch_posted.notify_all();
+    }
+
+    //====================================================
+    //     wait
+    //====================================================
+    /**
+     * @brief Method used to wait until every task of the posted batch has been run.
+     *
+     */
+    void WorkStealingPool::wait(){
+        std::unique_lock<std::mutex> lock( this -> mutex );
+        this -> batch_done.wait( lock, [ this ](){ return this -> remaining == 0; } );
+    }
+
+    //====================================================
+    //     run
+    //====================================================
+    /**
+     * @brief Method used to run a batch of tasks and wait for all of them.
+     *
+     * @param tasks The number of tasks, which the job receives as indexes from 0.
+     * @param job The job run for each task, with the index of the worker running it.
+     */
+    void WorkStealingPool::run( uint64_t tasks, std::function<void( uint32_t, uint64_t )> job ){
+        this -> post( tasks, std::move( job ) );
+        this -> wait();
+    }
+
+    //====================================================
+    //     size
+    //====================================================
+    /**
+     * @brief Getter used to get the number of workers.
+     *
+     * @return uint32_t The number of workers.
+     */
+    uint32_t WorkStealingPool::size() const {
+        return this -> threads;
+    }
+
+    //====================================================
+    //     pop
+    //====================================================
+    /**
+     * @brief Method used by a worker to take the newest task of its own queue.
+     *
+     * @param worker The worker index.
+     * @param task The taken task.
+     * @return true If a task has been taken.
+     * @return false If the queue is empty.
+     */
+    bool WorkStealingPool::pop( uint32_t worker, uint64_t& task ){
+        Queue& queue = this -> queues[ worker ];
+        const std::lock_guard<std::mutex> lock( queue.mutex );
+        if( queue.tasks.empty() ){
+            return false;
+        }
+        task = queue.tasks.back();
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    //====================================================
+    //     steal
+    //====================================================
+    /**
+     * @brief Method used by a worker to take the oldest task of the other queues, starting from its neighbour.
+     *
+     * @param thief The index of the stealing worker.
+     * @param task The stolen task.
+     * @return true If a task has been stolen.
+     * @return false If every queue is empty.
+     */
+    bool WorkStealingPool::steal( uint32_t thief, uint64_t& task ){
+        for( uint32_t i = 1; i < this -> threads; i++ ){
+            Queue& queue = this -> queues[ ( thief + i ) % this -> threads ];
+            const std::lock_guard<std::mutex> lock( queue.mutex );
+            if( ! queue.tasks.empty() ){
+                task = queue.tasks.front();
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //====================================================
+    //     work
+    //====================================================
+    /**
+     * @brief Method run by each worker, which runs the tasks of each posted batch until the pool is destroyed. Tasks never create new tasks, so once no task is found the worker waits for the next batch.
+     *
+     * @param worker The index of the worker.
+     */
+    void WorkStealingPool::work( uint32_t worker ){
+        SNAKE_TRACE_THREAD( "pool" );
+        uint64_t seen_batch = 0;
+        while( true ){
+            {
+                std::unique_lock<std::mutex> lock( this -> mutex );
+                this -> batch_posted.wait( lock, [ this, seen_batch ](){ return this -> batch != seen_batch || this -> stopping; } );
+                if( this -> batch == seen_batch ){
+                    return;
+                }
+                seen_batch = this -> batch;
+            }
+
+            uint64_t task;
+            while( this -> pop( worker, task ) || this -> steal( worker, task ) ){
+                this -> job( worker, task );
+                if( --this -> remaining == 0 ){
+                    const std::lock_guard<std::mutex> lock( this -> mutex );
+                    this -> batch_done.notify_all();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,95 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file timestep.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/timestep.hpp>
+
+// STD
+#include <algorithm>
+#include <cstdint>
+
+namespace snake::core{
+
+    //====================================================
+    //     FixedTimestep (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the FixedTimestep class.
+     *
+     * @param ticks_per_second The simulation rate.
+     */
+    FixedTimestep::FixedTimestep( double ticks_per_second ):
+        tick_duration( 1.0 / std::max( ticks_per_second, 1.0 ) ){
+
+    }
+
+    //====================================================
+    //     advance
+    //====================================================
+    /**
+     * @brief Method used to add the time elapsed since the last frame and get the number of ticks to be simulated. After a long hitch at most max_ticks_per_frame are run and the remaining time is dropped, so the game slows down instead of spiraling.
+     *
+     * @param elapsed_seconds Time elapsed since the last frame.
+     * @return uint32_t The number of ticks to be simulated.
+     */
+    uint32_t FixedTimestep::advance( double elapsed_seconds ){
+        this -> accumulator += std::max( elapsed_seconds, 0.0 );
+
+        uint32_t ticks = 0;
+        while( this -> accumulator >= this -> tick_duration && ticks < this -> max_ticks_per_frame ){
+            this -> accumulator -= this -> tick_duration;
+            ticks++;
+        }
+        if( ticks == this -> max_ticks_per_frame ){
+            this -> accumulator = std::min( this -> accumulator, this -> tick_duration );
+        }
+
+        return ticks;
+    }
+
+    //====================================================
+    //     reset
+    //====================================================
+    /**
+     * @brief Method used to drop the accumulated time, for example after the game has been paused.
+     *
+     */
+    void FixedTimestep::reset(){
+        this -> accumulator = 0.0;
+    }
+
+    //====================================================
+    //     alpha
+    //====================================================
+    /**
+     * @brief Getter used to get how far the current frame lies between the last tick and the next one.
+     *
+     * @return double The interpolation factor, in [0, 1].
+     */
+    double FixedTimestep::alpha() const {
+        return std::min( this -> accumulator / this -> tick_duration, 1.0 );
+    }
+
+    //====================================================
+    //     tickDuration
+    //====================================================
+    /**
+     * @brief Getter used to get the duration of a single tick.
+     *
+     * @return double The tick duration, in seconds.
+     */
+    double FixedTimestep::tickDuration() const {
+        return this -> tick_duration;
+    }
+}
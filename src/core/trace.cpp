@@ -0,0 +1,264 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file trace.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/trace.hpp>
+
+// STD
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace snake::core{
+
+    //====================================================
+    //     Static variables
+    //====================================================
+    std::atomic<bool> Trace::enabled{ false };
+    std::mutex Trace::mutex;
+    std::vector<std::shared_ptr<Trace::Buffer>> Trace::buffers;
+    std::atomic<uint64_t> Trace::event_count{ 0 };
+    std::atomic<uint64_t> Trace::dropped_events{ 0 };
+    std::vector<std::pair<uint32_t, const char*>> Trace::thread_names;
+    std::filesystem::path Trace::file_path;
+    std::chrono::steady_clock::time_point Trace::origin;
+
+    //====================================================
+    //     start
+    //====================================================
+    /**
+     * @brief Method used to start collecting events, which are written to file when the trace is stopped.
+     *
+     * @param path The path of the Chrome trace JSON file.
+     */
+    void Trace::start( const std::filesystem::path& path ){
+        const std::lock_guard<std::mutex> lock( mutex );
+        file_path = path;
+        origin = std::chrono::steady_clock::now();
+        for( const auto& buffer: buffers ){
+            const std::lock_guard<std::mutex> buffer_lock( buffer -> mutex );
+            buffer -> events.clear();
+        }
+        event_count = 0;
+        dropped_events = 0;
+        enabled = true;
+    }
+
+    //====================================================
+    //     stop
+    //====================================================
+    /**
+     * @brief Method used to stop collecting events and to write the collected ones, if the trace has been started.
+     *
+     * @return true If the trace file has been written, or the trace was not started.
+     * @return false If the trace file cannot be written.
+     */
+    bool Trace::stop(){
+        if( ! enabled.exchange( false ) ){
+            return true;
+        }
+        const std::lock_guard<std::mutex> lock( mutex );
+
+        std::ofstream file( file_path );
+        file << "{\"displayTimeUnit\":\"ms\",\"otherData\":{\"dropped_events\":" << dropped_events << "},\"traceEvents\":[";
+        const char* separator = "\n";
+        for( const auto& [ thread, name ]: thread_names ){
+            file << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+                 << ",\"args\":{\"name\":\"" << escape( name ) << "\"}}";
+            separator = ",\n";
+        }
+        for( const auto& buffer: buffers ){
+            const std::lock_guard<std::mutex> buffer_lock( buffer -> mutex );
+            for( const auto& event: buffer -> events ){
+                file << separator << "{\"name\":\"" << escape( event.name ) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer -> thread
+                     << ",\"ts\":" << event.begin << ",\"dur\":" << event.duration;
+                if( ! event.detail.empty() ){
+                    file << ",\"args\":{\"detail\":\"" << escape( event.detail ) << "\"}";
+                }
+                file << "}";
+                separator = ",\n";
+            }
+            buffer -> events.clear();
+        }
+        file << "\n]}\n";
+
+        return static_cast<bool>( file );
+    }
+
+    //====================================================
+    //     active
+    //====================================================
+    /**
+     * @brief Method used to know if events are being collected.
+     *
+     * @return true If the trace has been started.
+     * @return false Otherwise.
+     */
+    bool Trace::active(){
+        return enabled.load( std::memory_order_relaxed );
+    }
+
+    //====================================================
+    //     threadName
+    //====================================================
+    /**
+     * @brief Method used to name the calling thread in the trace timeline.
+     *
+     * @param name The thread name, which must outlive the trace.
+     */
+    void Trace::threadName( const char* name ){
+        const uint32_t thread = threadId();
+        const std::lock_guard<std::mutex> lock( mutex );
+        thread_names.emplace_back( thread, name );
+    }
+
+    //====================================================
+    //     record
+    //====================================================
+    /**
+     * @brief Method used to add a complete event to the buffer of the calling thread, which no other thread writes. Events past max_events are dropped.
+     *
+     * @param name The event name, which must outlive the trace.
+     * @param detail An optional detail shown among the event arguments.
+     * @param begin The time at which the event started.
+     * @param end The time at which the event ended.
+     */
+    void Trace::record( const char* name, std::string detail, std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end ){
+        if( ! active() ){
+            return;
+        }
+        if( event_count.fetch_add( 1, std::memory_order_relaxed ) >= max_events ){
+            dropped_events.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+        Buffer& buffer = threadBuffer();
+        const std::lock_guard<std::mutex> lock( buffer.mutex );
+        buffer.events.push_back( { name, std::move( detail ), microseconds( begin ), microseconds( end ) - microseconds( begin ) } );
+    }
+
+    //====================================================
+    //     threadId
+    //====================================================
+    /**
+     * @brief Method used to get a small number identifying the calling thread, in the order threads first show up.
+     *
+     * @return uint32_t The thread number.
+     */
+    uint32_t Trace::threadId(){
+        static std::atomic<uint32_t> next_id{ 1 };
+        thread_local const uint32_t id = next_id.fetch_add( 1, std::memory_order_relaxed );
+        return id;
+    }
+
+    //====================================================
+    //     threadBuffer
+    //====================================================
+    /**
+     * @brief Method used to get the event buffer of the calling thread, created and registered the first time the thread records an event. Buffers are kept after their thread ends, until they are written.
+     *
+     * @return Buffer& The buffer.
+     */
+    Trace::Buffer& Trace::threadBuffer(){
+        thread_local const std::shared_ptr<Buffer> buffer = [](){
+            auto created = std::make_shared<Buffer>();
+            created -> thread = threadId();
+            const std::lock_guard<std::mutex> lock( mutex );
+            buffers.push_back( created );
+            return created;
+        }();
+        return *buffer;
+    }
+
+    //====================================================
+    //     microseconds
+    //====================================================
+    /**
+     * @brief Method used to convert a time point into the microseconds passed since the trace start.
+     *
+     * @param time The time point.
+     * @return int64_t The trace timestamp.
+     */
+    int64_t Trace::microseconds( std::chrono::steady_clock::time_point time ){
+        return std::chrono::duration_cast<std::chrono::microseconds>( time - origin ).count();
+    }
+
+    //====================================================
+    //     escape
+    //====================================================
+    /**
+     * @brief Method used to escape a text so that it can be written in a JSON string.
+     *
+     * @param text The text to be escaped.
+     * @return std::string The escaped text.
+     */
+    std::string Trace::escape( const std::string& text ){
+        std::string escaped;
+        escaped.reserve( text.size() );
+        for( const char character: text ){
+            if( character == '"' || character == '\\' ){
+                escaped += '\\';
+                escaped += character;
+            }
+            else if( static_cast<unsigned char>( character ) < 0x20 ){
+                char code[ 7 ];
+                std::snprintf( code, sizeof( code ), "\\u%04x", static_cast<unsigned char>( character ) );
+                escaped += code;
+            }
+            else{
+                escaped += character;
+            }
+        }
+        return escaped;
+    }
+
+    //====================================================
+    //     TraceScope (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the TraceScope class. The clock is read, and the detail copied, only while the trace is active.
+     *
+     * @param name The event name, which must outlive the trace.
+     * @param detail An optional detail shown among the event arguments.
+     */
+    TraceScope::TraceScope( const char* name, std::string_view detail ):
+        name( name ),
+        recording( Trace::active() ){
+        if( this -> recording ){
+            this -> detail = detail;
+            this -> begin = std::chrono::steady_clock::now();
+        }
+    }
+
+    //====================================================
+    //     TraceScope (destructor)
+    //====================================================
+    /**
+     * @brief Destructor of the TraceScope class, which records the event.
+     *
+     */
+    TraceScope::~TraceScope(){
+        if( this -> recording ){
+            Trace::record( this -> name, std::move( this -> detail ), this -> begin, std::chrono::steady_clock::now() );
+        }
+    }
+}
@@ -12,9 +12,22 @@
 //     Headers
 //====================================================
 
+// Windows
+#include <windows/game_window.hpp>
+
 // Entities
 #include <entities/entity.hpp>
 
+// Core
+#include <core/types.hpp>
+#include <core/board.hpp>
+
+// SFML
+#include <SFML/System/Vector2.hpp>
+
+// STD
+#include <cstdint>
+
 namespace snake::entity{
 
     //====================================================
@@ -25,7 +38,9 @@ namespace snake::entity{
      * 
      * @param game_window THe window to which the entity is drawn into.
      */
-    Entity::Entity( window::GameWindow* game_window ): game_window( game_window ){
+    Entity::Entity( window::GameWindow* game_window ): 
+        game_window( game_window ),
+        board_top( boardTop( game_window ) ){
 
     }
 
@@ -39,4 +54,64 @@ namespace snake::entity{
     Entity::~Entity(){
 
     }
-}
\ No newline at end of file
+
+    //====================================================
+    //     makeBoard
+    //====================================================
+    /**
+     * @brief Method used to create the game board which fits the window area below the title bar.
+     * 
+     * @param game_window The window in which the game is played.
+     * @return core::Board The game board.
+     */
+    core::Board Entity::makeBoard( const window::GameWindow* game_window ){
+        return core::Board(
+            static_cast<int32_t>( game_window -> getSize().x / cell_size ),
+            static_cast<int32_t>( ( game_window -> getSize().y - boardTop( game_window ) ) / cell_size )
+        );
+    }
+
+    //====================================================
+    //     boardTop
+    //====================================================
+    /**
+     * @brief Method used to get the y coordinate of the board top, which lies on the title bar line.
+     * 
+     * @param game_window The window in which the game is played.
+     * @return float The y coordinate of the board top.
+     */
+    float Entity::boardTop( const window::GameWindow* game_window ){
+        return static_cast<float>( game_window -> getSize().x / 24 );
+    }
+
+    //====================================================
+    //     cellPosition
+    //====================================================
+    /**
+     * @brief Method used to get the window coordinates of the center of a board cell.
+     * 
+     * @param cell The board cell.
+     * @return sf::Vector2f The window coordinates of the cell center.
+     */
+    sf::Vector2f Entity::cellPosition( const core::Cell& cell ) const {
+        return sf::Vector2f( 
+            cell.x * cell_size + cell_size * 0.5f, 
+            this -> board_top + cell.y * cell_size + cell_size * 0.5f 
+        );
+    }
+
+    //====================================================
+    //     interpolate
+    //====================================================
+    /**
+     * @brief Method used to linearly interpolate between two window positions.
+     * 
+     * @param from The position at the last tick.
+     * @param to The position at the current tick.
+     * @param alpha The interpolation factor, in [0, 1].
+     * @return sf::Vector2f The interpolated position.
+     */
+    sf::Vector2f Entity::interpolate( const sf::Vector2f& from, const sf::Vector2f& to, float alpha ){
+        return from + ( to - from ) * alpha;
+    }
+}
@@ -29,8 +29,8 @@
 #include <entities/entity.hpp>
 #include <entities/food.hpp>
 
-// Utility
-#include <utility/generic.hpp>
+// Core
+#include <core/types.hpp>
 
 // Debug
 #ifdef DEBUG_SNAKE_GAME
@@ -46,17 +46,14 @@ namespace snake::entity{
     //     Food (constructor)
     //====================================================
     /**
-     * @brief Constructor of the food class.
+     * @brief Constructor of the food class. The position is set from each drawn snapshot.
      * 
+     * @param game_window The window to which the food is drawn into.
      */
-    Food::Food( window::GameWindow* game_window ): Entity( game_window ){
-        
-        // Setting random first position
-        this -> x_random = utility::random( 0, this -> x_bound );
-        this -> y_random = utility::random( 80, this -> y_bound );
+    Food::Food( window::GameWindow* game_window ): 
+        Entity( game_window ),
+        position{ 0, 0 }{
 
-        // Food settings
-        this -> food.setPosition( x_random, y_random );
     }
 
     //====================================================
@@ -67,19 +64,8 @@ namespace snake::entity{
      * 
      */
     void Food::draw() const {
-        this -> game_window -> draw( this -> food );
-    }
-
-    //====================================================
-    //     respawn
-    //====================================================
-    /**
-     * @brief Method used to respawn food when there is collision between snake and itself.
-     * 
-     */
-    void Food::respawn(){
-        this -> x_random = utility::random( 0, this -> x_bound );
-        this -> y_random = utility::random( 80, this -> y_bound );
-        this -> food.setPosition( x_random, y_random );
+        auto food_piece = this -> food;
+        food_piece.setPosition( this -> cellPosition( this -> position ) );
+        this -> game_window -> draw( food_piece );
     }
 }
\ No newline at end of file
@@ -29,6 +29,10 @@
 #include <entities/entity.hpp>
 #include <entities/snake.hpp>
 
+// Core
+#include <core/types.hpp>
+#include <core/snapshot.hpp>
+
 // Debug
 #ifdef DEBUG_SNAKE_GAME
     #include <ptc/print.hpp>
@@ -37,18 +41,14 @@
 // SFML
 #include <SFML/Graphics/Color.hpp> 
 #include <SFML/System/Vector2.hpp>
-#include <SFML/Window/Keyboard.hpp> 
-#include <SFML/Graphics/RectangleShape.hpp> 
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
 
 // STD
-#include <algorithm>
-#include <memory>
-#include <vector>
-#include <fstream>
-#include <filesystem>
-#include <string>
+#include <cstdint>
+#include <utility>
 
 namespace snake::entity{
 
@@ -58,240 +58,166 @@ namespace snake::entity{
     /**
      * @brief Constructor of the snake class.
      * 
+     * @param game_window The window to which the snake is drawn into.
+     * @param model The snake state captured from the game core.
      */
-    Snake::Snake( window::GameWindow* game_window ): Entity( game_window ){
-
-        // Snake body shape settings
-        this -> body_shape.setSize( sf::Vector2f( this -> body_dimension, this -> body_dimension ) );
-        this -> body_shape.setFillColor( sf::Color( 76, 153, 0 ) );
-        this -> body_shape.setOutlineColor( sf::Color::Black );
-        this -> body_shape.setOutlineThickness( 2 );
-        this -> body_shape.setPosition( this -> game_window_size_x / 2.0f - head.getGlobalBounds().width * 2.0f, 900.f );
-        this -> body_shape.setOrigin( ( sf::Vector2f )this -> body_shape.getSize() / 2.f );
-
-        // Adding first body piece to snake
-        this -> body.push_back( body_shape );
-
-        // Change speed if option is set
-        this -> speedV = std::stoi( 
-            game_window -> processInputFile( std::ifstream( this -> game_window -> options_file_path ), 1, 1 )
-         );
+    Snake::Snake( window::GameWindow* game_window, const core::SnakeView& model ): 
+        Entity( game_window ),
+        model( &model ),
+        body_vertices( sf::Triangles ),
+        slots( model.capacity() + 1 ){
+
+        // Every slot is stored twice, so that any run of slots starting in the first copy is contiguous
+        this -> body_vertices.resize( 2 * this -> slots * this -> vertices_per_slot );
+        this -> rebuild();
     }
 
     //====================================================
-    //     moveSmoothly
+    //     draw
     //====================================================
     /**
-     * @brief Method used to smoothly move an entity.
+     * @brief Method used to draw the snake entity: the whole body, tail included, is a single vertex range drawn with one call, followed by the head sprite.
      * 
-     * @param dt Delta time.
-     * @param dir_x X position.
-     * @param dir_y Y position.
      */
-    void Snake::moveSmoothly( const float dir_x, const float dir_y ){
+    void Snake::draw() const {
 
-        // Save directions
-        this -> direction_x = dir_x;
-        this -> direction_y = dir_y;
+        // Body and tail
+        this -> game_window -> draw( 
+            &this -> body_vertices[ this -> front * this -> vertices_per_slot ], 
+            ( this -> count + 1 ) * this -> vertices_per_slot, 
+            sf::Triangles 
+        );
 
-        // Move snake
-        this -> head.move( dir_x, dir_y );
-        std::for_each(
-            body.begin(), 
-            body.end(), 
-            [ &dir_x, &dir_y ]( auto& el ){ el.move( dir_x, dir_y ); } 
+        // Head
+        auto head_piece = this -> head;
+        head_piece.setPosition( 
+            this -> interpolate( 
+                this -> cellPosition( this -> model -> cell( 1 ) ), 
+                this -> cellPosition( this -> model -> head() ), 
+                this -> interpolation 
+            )
         );
+        head_piece.setRotation( headRotation( this -> model -> last_direction ) );
+        this -> game_window -> draw( head_piece );
     }
 
     //====================================================
-    //     update
+    //     sync
     //====================================================
     /**
-     * @brief Method used to update the entity movement.
+     * @brief Method used to bring the body vertices up to date with the model before drawing. Between two ticks only the ends of the snake change, so only the new head side cells are written and the tail side ones are dropped; the tail square, which slides towards the cell that follows it, is written after the last body cell.
      * 
+     * @param model The snake state to be drawn, which must outlive the next draw.
      */
-    void Snake::update(){
-
-        // Default movement
-        if( this -> direction_y < 0 ){ // UP
-            if( this -> head.getRotation() == 270 ){
-                this -> rotate( 90 );
-            }
-            else if( this -> head.getRotation() == 90 ){
-                this -> rotate( -90 ); 
-            }
-            else if( this -> head.getRotation() == 180 ){
-                this -> rotate( 180 ); 
-            }
-            this -> relHeadPos( 0, - this -> body[0].getSize().x );
-            this -> moveSmoothly( 0.f, - this -> speedV );
-            this -> setGrowPosition( 0, this -> body_dimension );
-        }
-        else if( this -> direction_y > 0 ){ // DOWN
-            if( this -> head.getRotation() == 270 ){
-                this -> rotate( -90 );
-            }
-            else if( this -> head.getRotation() == 90 ){
-                this -> rotate( 90 ); 
-            }
-            else if( this -> head.getRotation() == 0 ){
-                this -> rotate( 180 ); 
-            }
-            this -> relHeadPos( 0, this -> body[0].getSize().x );
-            this -> moveSmoothly( 0.f, this -> speedV );
-            this -> setGrowPosition( 0, -this -> body_dimension );
-        }
-        else if( this -> direction_x < 0 ){ // LEFT
-            if( this -> head.getRotation() == 0 ){
-                this -> rotate( -90 ); 
-            }
-            else if( this -> head.getRotation() == 180 ){
-                this -> rotate( 90 );
-            }
-            else if( this -> head.getRotation() == 90 ){
-                this -> rotate( 180 ); 
-            }
-            this -> relHeadPos( - this -> body[0].getSize().x, 0 );
-            this -> moveSmoothly( 0.f, 0.f );
-            this -> moveSmoothly( - this -> speedV, 0.f );
-            this -> setGrowPosition( this -> body_dimension, 0 );
+    void Snake::sync( const core::SnakeView& model ){
+        this -> model = &model;
+        const uint64_t ticks = this -> model -> moves() - this -> synced_moves;
+        const uint32_t body_cells = this -> model -> length() - 1;
+
+        // Push the cells entered since the last sync, or rebuild everything if they do not fit
+        if( ticks > body_cells ){
+            this -> rebuild();
         }
-        else if( this -> direction_x > 0 ){ // RIGHT
-            if( this -> head.getRotation() == 0 ){
-                this -> rotate( 90 );   
-            }
-            else if( this -> head.getRotation() == 180 ){
-                this -> rotate( -90 );   
-            }
-            else if( this -> head.getRotation() == 270 ){
-                this -> rotate( 180 ); 
+        else{
+            for( uint32_t i = static_cast<uint32_t>( ticks ); i > 0; i-- ){
+                this -> pushFront( this -> model -> cell( i ) );
             }
-            this -> relHeadPos( this -> body[0].getSize().x, 0 );
-            this -> moveSmoothly( 0.f, 0.f );
-            this -> moveSmoothly( this -> speedV, 0.f );
-            this -> setGrowPosition( -this -> body_dimension, 0 );
+            this -> count = body_cells;
+            this -> synced_moves = this -> model -> moves();
         }
 
-        // Key pressed changing direction
-        if( sf::Keyboard::isKeyPressed( sf::Keyboard::Up ) ){
-            this -> moveSmoothly( 0.f, - this -> infinitesimal_speedV );
-        }
-        else if( sf::Keyboard::isKeyPressed( sf::Keyboard::Down ) ){
-            this -> moveSmoothly( 0.f, this -> infinitesimal_speedV );
-        }
-        else if( sf::Keyboard::isKeyPressed( sf::Keyboard::Right ) ){
-            this -> moveSmoothly( this -> infinitesimal_speedV, 0.f );
-        }
-        else if( sf::Keyboard::isKeyPressed( sf::Keyboard::Left ) ){
-            this -> moveSmoothly( - this -> infinitesimal_speedV, 0.f );
-        }
-    }
-
-    //====================================================
-    //     setGrowPosition
-    //====================================================
-    /**
-     * @brief Method used to set the grow position.
-     * 
-     * @param x Increment of x position.
-     * @param y Increment of y position.
-     */
-    void Snake::setGrowPosition( float x, float y ){
-        if( body.size() > 1 ){
-            for( auto i = body.size() - 1; i > 0; i-- ){
-                this -> body[i].setPosition( 
-                    this -> body[i-1].getPosition().x + x, 
-                    this -> body[i-1].getPosition().y + y 
-                );
-            }
-        }   
-    }
-
-    //====================================================
-    //     draw
-    //====================================================
-    /**
-     * @brief Method used to draw the snake entity.
-     * 
-     */
-    void Snake::draw() const {
-        std::for_each(
-            this -> body.cbegin(),
-            this -> body.cend(),
-            [ this ]( const auto& el ){ this -> game_window -> draw( el ); }
+        // Tail leaving the cell freed during the last tick
+        this -> writeSlot( 
+            ( this -> front + this -> count ) % this -> slots,
+            this -> interpolate( 
+                this -> cellPosition( this -> model -> previous_tail ), 
+                this -> cellPosition( this -> model -> tail() ), 
+                this -> interpolation 
+            )
         );
-        this -> game_window -> draw( this -> head );
     }
 
     //====================================================
-    //     bodyGrow
+    //     rebuild
     //====================================================
     /**
-     * @brief Method used to grow the snake body when food is ate.
+     * @brief Method used to write again every body cell.
      * 
      */
-    void Snake::bodyGrow(){
-        auto body_piece = this -> body_shape;
-            if( this -> direction_y < 0 )
-                body_piece.setPosition( 
-                    this -> body[ body.size() - 1 ].getPosition().x, 
-                    this -> body[ body.size() - 1 ].getPosition().y + this -> body_dimension
-                );
-            else if( this -> direction_y > 0 )
-                body_piece.setPosition( 
-                    this -> body[ body.size() - 1 ].getPosition().x, 
-                    this -> body[ body.size() - 1 ].getPosition().y - this -> body_dimension
-                );
-            else if( this -> direction_x < 0 )
-                body_piece.setPosition( 
-                    this -> body[ body.size() - 1 ].getPosition().x + this -> body_dimension, 
-                    this -> body[ body.size() - 1 ].getPosition().y
-                );
-            else if( this -> direction_x > 0 )
-                body_piece.setPosition( 
-                    this -> body[ body.size() - 1 ].getPosition().x - this -> body_dimension, 
-                    this -> body[ body.size() - 1 ].getPosition().y
-                );
-        body_piece.setOrigin( this -> body[ body.size() - 1 ].getOrigin() );
-        this -> body.push_back( body_piece );
+    void Snake::rebuild(){
+        this -> front = 0;
+        this -> count = this -> model -> length() - 1;
+        for( uint32_t i = 0; i < this -> count; i++ ){
+            this -> writeSlot( i, this -> cellPosition( this -> model -> cell( i + 1 ) ) );
+        }
+        this -> synced_moves = this -> model -> moves();
     }
 
     //====================================================
-    //     relHeadPos
+    //     pushFront
     //====================================================
     /**
-     * @brief Method used to correct the head position with respect to the body one.
+     * @brief Method used to add a cell on the head side of the body.
      * 
-     * @param x The increment for the x position.
-     * @param y The increment for the y position.
+     * @param cell The new body cell.
      */
-    void Snake::relHeadPos( float x, float y ){
-        this -> head.setPosition(
-            this -> body[0].getPosition().x + x,
-            this -> body[0].getPosition().y + y
-        );
+    void Snake::pushFront( const core::Cell& cell ){
+        this -> front = ( this -> front == 0 ? this -> slots : this -> front ) - 1;
+        this -> writeSlot( this -> front, this -> cellPosition( cell ) );
     }
 
     //====================================================
-    //     death
+    //     writeSlot
     //====================================================
     /**
-     * @brief Method used to deal with snake death.
+     * @brief Method used to write the two triangles of the outline square and the two of the fill square of a body cell, in both copies of its slot.
      * 
+     * @param slot The slot of the body cell.
+     * @param center The window coordinates of the cell center.
      */
-    void Snake::death(){
-        this -> speedV = 0;
+    void Snake::writeSlot( uint32_t slot, const sf::Vector2f& center ){
+        static const sf::Color fill_color( 76, 153, 0 );
+        static const sf::Color outline_color( sf::Color::Black );
+        constexpr float fill_half = body_dimension / 2.f;
+        constexpr float outline_half = fill_half + outline_thickness;
+
+        for( const uint32_t copy: { slot, slot + this -> slots } ){
+            sf::Vertex* quad = &this -> body_vertices[ copy * this -> vertices_per_slot ];
+            for( const auto& [ half, color ]: { std::pair{ outline_half, outline_color }, std::pair{ fill_half, fill_color } } ){
+                const sf::Vector2f top_left( center.x - half, center.y - half );
+                const sf::Vector2f top_right( center.x + half, center.y - half );
+                const sf::Vector2f bottom_right( center.x + half, center.y + half );
+                const sf::Vector2f bottom_left( center.x - half, center.y + half );
+                quad[ 0 ] = sf::Vertex( top_left, color );
+                quad[ 1 ] = sf::Vertex( top_right, color );
+                quad[ 2 ] = sf::Vertex( bottom_right, color );
+                quad[ 3 ] = sf::Vertex( top_left, color );
+                quad[ 4 ] = sf::Vertex( bottom_right, color );
+                quad[ 5 ] = sf::Vertex( bottom_left, color );
+                quad += 6;
+            }
+        }
     }
 
     //====================================================
-    //     rotate
+    //     headRotation
     //====================================================
     /**
-     * @brief Method used to rotate snake.
+     * @brief Method used to get the head sprite rotation corresponding to a movement direction.
      * 
-     * @param angle Rotation angle.
+     * @param direction The movement direction.
+     * @return float The rotation angle, in degrees.
      */
-    void Snake::rotate( float angle ){
-        this -> head.rotate( angle ); 
+    float Snake::headRotation( core::Direction direction ){
+        switch( direction ){
+            case core::Direction::Up:
+                return 0.f;
+            case core::Direction::Down:
+                return 180.f;
+            case core::Direction::Left:
+                return 270.f;
+            default:
+                return 90.f;
+        }
     }
-}
\ No newline at end of file
+}
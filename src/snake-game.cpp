@@ -15,11 +15,67 @@
 // Windows
 #include <windows/game_window.hpp>
 
+// Utility
+#include <utility/resources.hpp>
+
+// Core
+#include <core/asset_archive.hpp>
+#include <core/trace.hpp>
+
+// STD
+#include <string_view>
+#include <charconv>
+#include <cstdint>
+#include <filesystem>
+#include <exception>
+#include <iostream>
+
 //====================================================
 //     main
 //====================================================
-int main(){
+int main( int argc, char** argv ){
+
+    // Read a fixed game seed ("--seed <n>") or a replay to be played ("--replay <file>")
+    for( int i = 1; i + 1 < argc; ++i ){
+        const std::string_view arg{ argv[ i ] }, value{ argv[ i + 1 ] };
+        uint64_t seed;
+        if( arg == "--seed" && std::from_chars( value.data(), value.data() + value.size(), seed ).ec == std::errc() ){
+            snake::window::GameWindow::seed_option = seed;
+        }
+        else if( arg == "--replay" ){
+            snake::window::GameWindow::replay_option = std::filesystem::path( value );
+        }
+    }
+
+    // Record a timeline of the session ("--trace <file>")
+    #ifdef SNAKE_GAME_TRACE
+        for( int i = 1; i + 1 < argc; ++i ){
+            if( std::string_view{ argv[ i ] } == "--trace" ){
+                snake::core::Trace::start( argv[ i + 1 ] );
+            }
+        }
+        SNAKE_TRACE_THREAD( "main" );
+    #endif
+
+    // Read the assets from the archive next to the executable, or from the working directory without it
+    snake::utility::Resources::mount( snake::core::AssetArchive::defaultPath( argv[ 0 ] ) );
+
+    // Running the app (missing assets are reported by the resource cache)
+    int status = 0;
+    try{
+        auto game_window{ snake::window::GameWindow() };
+    }
+    catch( const std::exception& exception ){
+        std::cerr << exception.what() << "\n";
+        status = 1;
+    }
+
+    // Write the timeline
+    #ifdef SNAKE_GAME_TRACE
+        if( ! snake::core::Trace::stop() ){
+            std::cerr << "Cannot write the trace file\n";
+        }
+    #endif
 
-    // Running the app
-    auto game_window{ snake::window::GameWindow() };
+    return status;
 }
\ No newline at end of file
@@ -34,6 +34,28 @@
 #include <entities/snake.hpp>
 #include <entities/food.hpp>
 
+// Widgets
+#include <widgets/widget.hpp>
+
+// Utility
+#include <utility/generic.hpp>
+#include <utility/resources.hpp>
+
+// Core
+#include <core/types.hpp>
+#include <core/game.hpp>
+#include <core/timestep.hpp>
+#include <core/input_queue.hpp>
+#include <core/replay.hpp>
+#include <core/game_files.hpp>
+#include <core/io_worker.hpp>
+#include <core/score_store.hpp>
+#include <core/stats_store.hpp>
+#include <core/options.hpp>
+#include <core/snapshot.hpp>
+#include <core/frame_profile.hpp>
+#include <core/trace.hpp>
+
 // Debug
 #ifdef DEBUG_SNAKE_GAME
     #include <ptc/print.hpp>
@@ -46,9 +68,15 @@
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/Graphics/PrimitiveType.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp> 
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Event.hpp>
 #include <SFML/Audio/Sound.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 
@@ -59,16 +87,18 @@
 #include <string_view> 
 #include <vector> 
 #include <fstream>
+#include <sstream>
 #include <filesystem>
+#include <cstdint>
+#include <cmath>
+#include <optional>
+#include <iostream>
+#include <exception>
+#include <stdexcept>
+#include <thread>
 
 namespace snake::state{
 
-    //====================================================
-    //     Static variables
-    //====================================================
-    sf::SoundBuffer GameState::state_sound_1;
-    sf::SoundBuffer GameState::state_sound_2;
-
     //====================================================
     //     GameState (constructor)
     //====================================================
@@ -82,41 +112,34 @@ namespace snake::state{
         background_file( "img/images/game_background.jpg" ){
 
         // Set snake head and texture properties
-        this -> state_texture_1.loadFromFile( "img/textures/snake_head.png" );;
-        this -> snake -> head.setTexture( this -> state_texture_1 );
-        this -> snake -> head.setOrigin( ( sf::Vector2f )this -> state_texture_1.getSize() / 2.f );
-        this -> snake -> relHeadPos( 0, - this -> snake -> body[0].getSize().y );
+        const auto& snake_head_texture = utility::Resources::texture( "img/textures/snake_head.png" );
+        this -> snake -> head.setTexture( snake_head_texture );
+        this -> snake -> head.setOrigin( ( sf::Vector2f )snake_head_texture.getSize() / 2.f );
 
         // Set food texture properties
-        this -> state_texture_2.loadFromFile( "img/textures/food.png" );
-        this -> food -> food.setTexture( this -> state_texture_2 );
+        const auto& food_texture = utility::Resources::texture( "img/textures/food.png" );
+        this -> food -> food.setTexture( food_texture );
+        this -> food -> food.setOrigin( ( sf::Vector2f )food_texture.getSize() / 2.f );
 
-        // Default move up
-        this -> snake -> moveSmoothly( 0.f, - this -> snake -> speedV );
+        // Options, parsed once by the window
+        const core::Options& options = this -> game_window -> options;
 
-        // Change background
-        this -> process_background = this -> game_window -> processInputFile( 
-            std::ifstream( this -> game_window -> options_file_path ), 2, 1 
+        // Change speed if option is set (the default speed runs 15 ticks per second)
+        const int32_t speed = options.speed;
+        this -> timestep = core::FixedTimestep( 
+            std::max( 1.0, static_cast<double>( this -> default_ticks_per_second ) * speed / this -> default_speed ) 
         );
-        if( this -> process_background != "default" ){
-            this -> background_file = this -> process_background;
+
+        // Change background
+        if( options.background != "default" ){
+            this -> background_file = options.background;
         }
 
         // Save player name
-        this -> player_name = this -> game_window -> processInputFile(
-            std::ifstream( this -> game_window -> options_file_path ), 0, 1
-        );
+        this -> player_name = options.player;
 
         // Get best score
-        if( this -> game_window -> scores_container.size() == 0 ){
-            this -> best_score = 0;
-        }
-        else{
-            this -> best_score = *max_element( 
-                this -> game_window -> scores_container.begin(), 
-                this -> game_window -> scores_container.end() 
-            );
-        }
+        this -> best_score = this -> game_window -> score_store.best();
 
         // Load sounds
         this -> loadSounds();
@@ -125,27 +148,229 @@ namespace snake::state{
         this -> drawWidgets();
     }
 
+    //====================================================
+    //     GameState (destructor)
+    //====================================================
+    /**
+     * @brief Destructor of the GameState class. The render thread is stopped, giving the window context back to the main thread.
+     * 
+     */
+    GameState::~GameState(){
+        this -> stopRendering();
+    }
+
     //====================================================
     //     drawState
     //====================================================
     /**
-     * @brief Method used to draw the current state.
+     * @brief Method used to draw the current state. Frames are drawn by the render thread, so the main thread only makes sure it is running and then sleeps until the next tick is due, waking up often enough to keep input timestamps accurate.
      * 
      */
     void GameState::drawState() {
+        SNAKE_TRACE_SCOPE( "GameState::drawState" );
+
+        // Hand the window to the render thread
+        if( ! this -> render_thread.joinable() && this -> game_window -> isOpen() ){
+            this -> startRendering();
+        }
+
+        // Wait for the next tick
+        const double until_tick = ( 1.0 - this -> timestep.alpha() ) * this -> timestep.tickDuration();
+        sf::sleep( sf::seconds( static_cast<float>( std::min( until_tick, this -> max_idle_time ) ) ) );
+    }
+
+    //====================================================
+    //     startRendering
+    //====================================================
+    /**
+     * @brief Method used to start the render thread. The window context is released here and activated again in the render thread, which owns it until it is stopped.
+     * 
+     */
+    void GameState::startRendering(){
+        this -> game_window -> setActive( false );
+        this -> rendering = true;
+        this -> render_thread = std::thread( &GameState::renderLoop, this, this -> timestep.tickDuration() );
+    }
+
+    //====================================================
+    //     stopRendering
+    //====================================================
+    /**
+     * @brief Method used to stop the render thread, if running, and to activate the window context in the main thread again.
+     * 
+     */
+    void GameState::stopRendering(){
+        if( ! this -> render_thread.joinable() ){
+            return;
+        }
+        this -> rendering = false;
+        this -> render_thread.join();
+        this -> game_window -> setActive( true );
+    }
+
+    //====================================================
+    //     renderLoop
+    //====================================================
+    /**
+     * @brief Method run by the render thread: it draws the newest published snapshot, interpolated by the time passed since its last tick was due, once per display refresh. Frames are also kept at least min_frame_time apart, so that the thread does not spin when the driver ignores vertical sync. Only rendering members are used here, while the simulation ones belong to the main thread.
+     * 
+     * @param tick_duration The duration of a simulation tick, in seconds.
+     */
+    void GameState::renderLoop( double tick_duration ){
+        SNAKE_TRACE_THREAD( "render" );
+        this -> game_window -> setActive( true );
+        sf::Clock frame_clock;
+        while( this -> rendering ){
+            this -> snapshots.acquire();
+            const auto& snapshot = this -> snapshots.front();
+            const double since_tick = this -> snapshot_clock.getElapsedTime().asSeconds() - snapshot.time;
+            const double interpolation = snapshot.alive ? std::clamp( since_tick / tick_duration, 0.0, 1.0 ) : 1.0;
+            this -> drawFrame( snapshot, static_cast<float>( interpolation ) );
+
+            // Sleep until the next frame is due
+            const double frame_time = frame_clock.getElapsedTime().asSeconds();
+            if( frame_time < min_frame_time ){
+                sf::sleep( sf::seconds( static_cast<float>( min_frame_time - frame_time ) ) );
+            }
+            frame_clock.restart();
+        }
+        this -> game_window -> setActive( false );
+    }
+
+    //====================================================
+    //     drawFrame
+    //====================================================
+    /**
+     * @brief Method used to draw a frame of the game.
+     * 
+     * @param snapshot The game state to be drawn.
+     * @param interpolation The fraction of tick passed since the snapshot, used to slide the snake ends.
+     */
+    void GameState::drawFrame( const core::Snapshot& snapshot, float interpolation ){
+        SNAKE_TRACE_SCOPE( "GameState::drawFrame" );
 
         // Clear the window
         this -> game_window -> clear( this -> background_color );
 
-        // Drawing and updating entities
+        // Drawing entities, interpolated between the last two ticks
+        this -> snake -> interpolation = interpolation;
+        this -> snake -> sync( snapshot.snake );
+        this -> food -> position = snapshot.food;
+        this -> frame_score = snapshot.score;
+        auto& profile = this -> game_window -> performance_overlay.profile;
+        sf::Clock phase_clock;
         this -> packWidgets();
+        profile.addPhase( core::Phase::PackWidgets, phase_clock.restart().asSeconds() );
         this -> drawEntities();
-        this -> updateEntities();
-        this -> gameRules();
+        profile.addPhase( core::Phase::DrawEntities, phase_clock.restart().asSeconds() );
         
-        // Display the state
-        this -> game_window -> setFramerateLimit( 15 );
-        this -> game_window -> display();
+        // Display the state, with the performance overlay on top
+        this -> game_window -> performance_overlay.frame( *this -> game_window );
+        phase_clock.restart();
+        {
+            SNAKE_TRACE_SCOPE( "display" );
+            this -> game_window -> display();
+        }
+        profile.addPhase( core::Phase::Display, phase_clock.restart().asSeconds() );
+    }
+
+    //====================================================
+    //     updateState
+    //====================================================
+    /**
+     * @brief Method used to run the simulation ticks due in the time elapsed since the last frame, then to publish the state reached to the render thread.
+     * 
+     * @param elapsed Time elapsed since the last frame.
+     */
+    void GameState::updateState( const sf::Time& elapsed ){
+        SNAKE_TRACE_SCOPE( "GameState::updateState" );
+        auto& profile = this -> game_window -> performance_overlay.profile;
+
+        // The first frame after a pause lasts as long as the pause, which is not simulated
+        const uint32_t ticks = this -> resumed ? 0 : this -> timestep.advance( elapsed.asSeconds() );
+        this -> resumed = false;
+        for( uint32_t i = 0; i < ticks && this -> game -> alive; i++ ){
+            sf::Clock phase_clock;
+            this -> updateEntities();
+            profile.addPhase( core::Phase::UpdateEntities, phase_clock.restart().asSeconds() );
+            this -> gameRules();
+            profile.addPhase( core::Phase::GameRules, phase_clock.restart().asSeconds() );
+        }
+
+        // Publish the state reached, stamped with the time at which its last tick was due
+        if( ticks > 0 ){
+            const double now = this -> snapshot_clock.getElapsedTime().asSeconds();
+            this -> snapshots.back().capture( *this -> game, now - this -> timestep.alpha() * this -> timestep.tickDuration() );
+            this -> snapshots.publish();
+        }
+    }
+
+    //====================================================
+    //     keyPressed
+    //====================================================
+    /**
+     * @brief Method used to queue the turn pressed by the player, so that quick sequences of turns are consumed one per tick instead of being lost.
+     * 
+     * @param event The key pressed event.
+     */
+    void GameState::keyPressed( const sf::Event& event ){
+        if( this -> playback ){
+            return;
+        }
+        auto input = core::Input::None;
+        switch( event.key.code ){
+            case sf::Keyboard::Up:
+                input = core::Input::Up;
+                break;
+            case sf::Keyboard::Down:
+                input = core::Input::Down;
+                break;
+            case sf::Keyboard::Left:
+                input = core::Input::Left;
+                break;
+            case sf::Keyboard::Right:
+                input = core::Input::Right;
+                break;
+            default:
+                return;
+        }
+        this -> input_queue.push( input, this -> game -> snake.last_direction, this -> input_clock.getElapsedTime().asSeconds() );
+    }
+
+    //====================================================
+    //     isStatic
+    //====================================================
+    /**
+     * @brief Method used to know if the state changes only in response to window events. The game moves every frame.
+     * 
+     * @return false Always.
+     */
+    bool GameState::isStatic() const {
+        return false;
+    }
+
+    //====================================================
+    //     pauseState
+    //====================================================
+    /**
+     * @brief Method used to pause the game before the pause window is opened. The render thread is stopped, so that it does not draw the game window for the whole pause while the main thread uses the context and the resource cache; drawState starts it again once the game is resumed.
+     * 
+     */
+    void GameState::pauseState(){
+        this -> stopRendering();
+    }
+
+    //====================================================
+    //     resumeState
+    //====================================================
+    /**
+     * @brief Method used to resume the game after a pause. The time accumulated before the pause is dropped, and so is the frame time that includes the pause, so the game does not jump ahead. Turns queued before the pause are dropped too, so they are not played after it and their latency does not count the pause.
+     * 
+     */
+    void GameState::resumeState(){
+        this -> timestep.reset();
+        this -> input_queue.clear();
+        this -> resumed = true;
     }
 
     //====================================================
@@ -168,7 +393,17 @@ namespace snake::state{
      * 
      */
     void GameState::updateEntities() {
-        this -> snake -> update();
+        SNAKE_TRACE_SCOPE( "GameState::updateEntities" );
+
+        // Advance the simulation with the oldest queued turn, or the recorded one in playback
+        const auto input = this -> playback ? 
+            this -> playback -> next( this -> game -> ticks ) : 
+            this -> input_queue.pop( this -> input_clock.getElapsedTime().asSeconds() );
+        if( ! this -> playback && input != core::Input::None ){
+            this -> game_window -> performance_overlay.profile.addPhase( core::Phase::InputLatency, this -> input_queue.lastLatency() );
+        }
+        this -> recording.record( this -> game -> ticks, input );
+        this -> step_result = this -> game -> step( input );
     }
 
     //====================================================
@@ -180,18 +415,45 @@ namespace snake::state{
      */
     void GameState::gameOver(){
 
+        // Take the window back from the render thread
+        this -> stopRendering();
+
         // Kill snake
         this -> snake_looses.play();
-        this -> snake -> death();
 
-        // Append score to the score file
-        std::ofstream score_file( this -> game_window -> score_file_path, std::ios::app );
-        if( ! score_file ){
-            std::ofstream default_settings( this -> game_window -> score_file_path );
-            default_settings.close();
+        // Input latency report
+        #ifdef DEBUG_SNAKE_GAME
+            ptc::print( 
+                "Input latency over", this -> input_queue.latencySamples(), "turns (ms): mean", 
+                this -> input_queue.meanLatency() * 1000.0, "max", this -> input_queue.maxLatency() * 1000.0 
+            );
+        #endif
+
+        // Append score to the score store, add the game to the player statistics and save the replay to a new file on the I/O worker (played back games are not saved again)
+        if( ! this -> playback ){
+            auto& io_worker = window::GameWindow::io_worker;
+            io_worker.post( [ score_store = &this -> game_window -> score_store, entry = core::ScoreEntry{ this -> game -> score, this -> player_name } ](){
+                SNAKE_TRACE_SCOPE( "GameState::gameOver score" );
+                if( ! score_store -> append( entry ) ){
+                    std::cerr << "Cannot append the score to the score store\n";
+                }
+            } );
+            const auto play_time = static_cast<uint64_t>( std::llround( this -> game -> ticks * this -> timestep.tickDuration() * 1000.0 ) );
+            io_worker.post( [ stats_store = &this -> game_window -> stats_store, game = core::GameStats{ this -> player_name, this -> game -> score, this -> food_eaten, play_time } ](){
+                SNAKE_TRACE_SCOPE( "GameState::gameOver stats" );
+                if( ! stats_store -> add( game ) ){
+                    std::cerr << "Cannot save the player statistics\n";
+                }
+            } );
+            io_worker.post( [ path = core::replayPath( this -> game_window -> replay_directory_path, this -> game_window -> next_replay++ ), replay = this -> recording ](){
+                SNAKE_TRACE_SCOPE( "GameState::gameOver replay" );
+                std::ostringstream replay_file;
+                replay.save( replay_file );
+                if( ! core::writeFileAtomically( path, replay_file.str() ) ){
+                    std::cerr << "Cannot save the replay to " << path.string() << "\n";
+                }
+            } );
         }
-        score_file << this -> score << " " << this -> player_name << "\n";
-        score_file.close();
 
         // Return to menu or quit game
         auto pause_window{ snake::window::PauseWindow( "GameOver" ) };
@@ -208,39 +470,22 @@ namespace snake::state{
     //     gameRules
     //====================================================
     /**
-     * @brief Method used to set the game rules.
+     * @brief Method used to react to the game rules outcome of the last simulation step.
      * 
      */
     void GameState::gameRules(){
+        SNAKE_TRACE_SCOPE( "GameState::gameRules" );
 
-        // Check for collisions among snake head and food
-        const sf::FloatRect head_bounding{ this -> snake -> head.getGlobalBounds() };
-        const sf::FloatRect food_bounding{ this -> food -> food.getGlobalBounds() };
-        if( head_bounding.intersects( food_bounding ) ){
+        // Snake ate the food
+        if( this -> step_result.ate_food ){
+            this -> food_eaten++;
             this -> snake_eat.play();
-            this -> food -> respawn();
-            this -> snake -> bodyGrow();
-            this -> score += 1;
         }
 
-        // Check for collisions among snake and the window border
-        const auto snake_x_pos = this -> snake -> head.getPosition().x;
-        const auto snake_y_pos = this -> snake -> head.getPosition().y;
-        if( snake_x_pos >= window_x_max + window_x_max * 0.01 || snake_x_pos <= 0 - window_x_max * 0.01 || snake_y_pos >= window_y_max + window_y_max * 0.01 || snake_y_pos <= horizontal_line_y_coord - window_y_max * 0.01 ){
+        // Snake hit the window border or its body, or filled the whole board
+        if( this -> step_result.died || this -> step_result.won ){
             this -> gameOver();
         }
-
-        // Check for collision among snake and its body
-        std::for_each( 
-            this -> snake -> body.begin() + 1, 
-            this -> snake -> body.end(), 
-            [ &head_bounding, this ]( auto& elem ) {
-                const sf::FloatRect body_bounding{ elem.getGlobalBounds() };
-                if( head_bounding.intersects( body_bounding ) ){
-                    this -> gameOver();
-                }
-            }
-        );
     }
 
     //====================================================
@@ -253,7 +498,7 @@ namespace snake::state{
     void GameState::drawWidgets(){
 
         // Score icon
-        this -> score_icon.setTexture( this -> state_texture_2 );
+        this -> score_icon.setTexture( utility::Resources::texture( "img/textures/food.png" ) );
         this -> score_icon.setPosition( 
             window_x_max * 0.02f, 
             window_y_max * 0.013f 
@@ -268,8 +513,7 @@ namespace snake::state{
         this -> score_update.setCharacterSize( this -> text_size + 6 );
 
         // Best score icon
-        this -> state_texture_6.loadFromFile( "img/textures/best_score.png" );
-        this -> best_score_icon.setTexture( this -> state_texture_6 );
+        this -> best_score_icon.setTexture( utility::Resources::texture( "img/textures/best_score.png" ) );
         this -> best_score_icon.setPosition( 
             window_x_max * 0.02f + this -> score_update.getPosition().x * 2.0f, 
             window_y_max * 0.015f
@@ -284,8 +528,7 @@ namespace snake::state{
         this -> best_score_text.setCharacterSize( this -> text_size + 6 );
 
         // Current player icon
-        this -> state_texture_7.loadFromFile( "img/textures/player_icon.png" );
-        this -> player_icon.setTexture( this -> state_texture_7 );
+        this -> player_icon.setTexture( utility::Resources::texture( "img/textures/player_icon.png" ) );
         this -> player_icon.setPosition( 
             window_x_max * 0.02f + this -> best_score_text.getPosition().x * 1.5f, 
             window_y_max * 0.02f
@@ -306,61 +549,85 @@ namespace snake::state{
         this -> horizontal_line[1].color = sf::Color::Black;
 
         // Background
-        if( ! this -> state_texture_3.loadFromFile( this -> background_file ) ){
-            this -> game_window -> close();
-        }
         this -> background.setSize( 
             sf::Vector2f( 
                 window_x_max, 
                 window_y_max
             )
         );
-        this -> background.setTexture( &state_texture_3, true );
+        this -> background.setTexture( &utility::Resources::texture( this -> background_file ), true );
 
         // Title background
-        if( ! this -> state_texture_4.loadFromFile( "img/images/title_game_background.jpg" ) ){
-            this -> game_window -> close();
-        }
         this -> title_background.setSize( 
             sf::Vector2f( 
                 window_x_max, 
                 this -> horizontal_line_y_coord
             )
         );
-        this -> title_background.setTexture( &state_texture_4, true );
+        this -> title_background.setTexture( &utility::Resources::texture( "img/images/title_game_background.jpg" ), true );
+
+        // Texts font
+        this -> score_update.setFont( this -> font );
+        this -> best_score_text.setFont( this -> font );
+        this -> current_player_text.setFont( this -> font );
+
+        // HUD layer, holding the background and everything above it but the snake and the food
+        if( ! this -> hud_texture -> create( window_x_max, window_y_max ) ){
+            throw std::runtime_error( "Cannot create the HUD texture" );
+        }
+        this -> hud_sprite.setTexture( this -> hud_texture -> getTexture(), true );
+        this -> hud_dirty = true;
     }
 
     //====================================================
     //     packWidgets
     //====================================================
     /**
-     * @brief Method used to update widgets on the current state.
+     * @brief Method used to update widgets on the current state. The HUD layer is rendered again only if one of its texts changed, then it is drawn as a single sprite.
      * 
      */
     void GameState::packWidgets(){
+        if( this -> hud_dirty || 
+            this -> hud_score != this -> frame_score || 
+            this -> hud_best_score != this -> best_score || 
+            this -> hud_player_name != this -> player_name ){
+            this -> renderHud();
+        }
+        this -> game_window -> draw( this -> hud_sprite );
+    }
 
-        // Score text settings
-        this -> score_update.setFont( this -> font );
-        this -> score_update.setString( std::to_string( this -> score ) );
-
-        // Best score text settings
-        this -> best_score_text.setFont( this -> font );
-        this -> best_score_text.setString( std::to_string( this -> best_score ) );
+    //====================================================
+    //     renderHud
+    //====================================================
+    /**
+     * @brief Method used to render the background, the title bar and its texts and icons into the HUD layer.
+     * 
+     */
+    void GameState::renderHud(){
 
-        // Current player text settings
-        this -> current_player_text.setFont( this -> font );
-        this -> current_player_text.setString( this -> player_name );
+        // Texts
+        widget::Widget::updateText( this -> score_update, std::to_string( this -> frame_score ) );
+        widget::Widget::updateText( this -> best_score_text, std::to_string( this -> best_score ) );
+        widget::Widget::updateText( this -> current_player_text, this -> player_name );
 
         // Draw stuff
-        this -> game_window -> draw( this -> background );
-        this -> game_window -> draw( this -> title_background );
-        this -> game_window -> draw( this -> score_update );
-        this -> game_window -> draw( this -> best_score_text );
-        this -> game_window -> draw( this -> score_icon );
-        this -> game_window -> draw( this -> best_score_icon );
-        this -> game_window -> draw( this -> horizontal_line, 2, sf::Lines );
-        this -> game_window -> draw( this -> current_player_text );
-        this -> game_window -> draw( this -> player_icon );
+        this -> hud_texture -> clear( this -> background_color );
+        this -> hud_texture -> draw( this -> background );
+        this -> hud_texture -> draw( this -> title_background );
+        this -> hud_texture -> draw( this -> score_update );
+        this -> hud_texture -> draw( this -> best_score_text );
+        this -> hud_texture -> draw( this -> score_icon );
+        this -> hud_texture -> draw( this -> best_score_icon );
+        this -> hud_texture -> draw( this -> horizontal_line, 2, sf::Lines );
+        this -> hud_texture -> draw( this -> current_player_text );
+        this -> hud_texture -> draw( this -> player_icon );
+        this -> hud_texture -> display();
+
+        // Remember what has been rendered
+        this -> hud_score = this -> frame_score;
+        this -> hud_best_score = this -> best_score;
+        this -> hud_player_name = this -> player_name;
+        this -> hud_dirty = false;
     }
 
     //====================================================
@@ -373,11 +640,70 @@ namespace snake::state{
     void GameState::loadSounds(){
 
         // Snake eat
-        this -> state_sound_1.loadFromFile( "sounds/effects/snake_eat.wav" );
-        this -> snake_eat.setBuffer( this -> state_sound_1 );
+        this -> snake_eat.setBuffer( utility::Resources::soundBuffer( "sounds/effects/snake_eat.wav" ) );
 
         // Snake looses
-        this -> state_sound_2.loadFromFile( "sounds/effects/snake_looses.wav" );
-        this -> snake_looses.setBuffer( this -> state_sound_2 );
+        this -> snake_looses.setBuffer( utility::Resources::soundBuffer( "sounds/effects/snake_looses.wav" ) );
+    }
+
+    //====================================================
+    //     gameSeed
+    //====================================================
+    /**
+     * @brief Method used to choose the seed of a new game. The "--seed" command line option has priority over the "Seed" row of the options file; if neither gives a number, a random seed is drawn.
+     * 
+     * @param game_window The window to which the state is drawn.
+     * @return uint64_t The seed of the game.
+     */
+    uint64_t GameState::gameSeed( window::GameWindow* game_window ){
+        if( window::GameWindow::seed_option ){
+            return *window::GameWindow::seed_option;
+        }
+        if( game_window -> options.seed ){
+            return *game_window -> options.seed;
+        }
+        return utility::randomSeed();
+    }
+
+    //====================================================
+    //     loadPlayback
+    //====================================================
+    /**
+     * @brief Method used to load the replay given with the "--replay" command line option. The option is consumed, so that only the first game is played back.
+     * 
+     * @return std::optional<core::Replay> The replay to be played, if any.
+     */
+    std::optional<core::Replay> GameState::loadPlayback(){
+        if( ! window::GameWindow::replay_option ){
+            return std::nullopt;
+        }
+        std::ifstream replay_file( *window::GameWindow::replay_option, std::ios::binary );
+        window::GameWindow::replay_option.reset();
+        try{
+            return core::Replay::load( replay_file );
+        }
+        catch( const std::exception& exception ){
+            #ifdef DEBUG_SNAKE_GAME
+                ptc::print( "Replay not played:", exception.what() );
+            #endif
+            return std::nullopt;
+        }
+    }
+
+    //====================================================
+    //     makeGame
+    //====================================================
+    /**
+     * @brief Method used to create the simulated game, either from a replay or from the window size and the chosen seed.
+     * 
+     * @param game_window The window to which the state is drawn.
+     * @param playback The replay to be played, if any.
+     * @return std::unique_ptr<core::Game> The new game.
+     */
+    std::unique_ptr<core::Game> GameState::makeGame( window::GameWindow* game_window, const std::optional<core::Replay>& playback ){
+        if( playback ){
+            return std::make_unique<core::Game>( playback -> board, playback -> seed );
+        }
+        return std::make_unique<core::Game>( entity::Entity::makeBoard( game_window ), gameSeed( game_window ) );
     }
 }
\ No newline at end of file
@@ -33,6 +33,13 @@
 
 // Widgets
 #include <widgets/button.hpp>
+#include <widgets/widget.hpp>
+
+// Utility
+#include <utility/resources.hpp>
+
+// Core
+#include <core/trace.hpp>
 
 // SFML
 #include <SFML/Graphics/Color.hpp>
@@ -81,6 +88,7 @@ namespace snake::state{
      * 
      */
     void MenuState::drawState() {
+        SNAKE_TRACE_SCOPE( "MenuState::drawState" );
 
         // Clear the window
         this -> game_window -> clear( this -> background_color );
@@ -92,7 +100,8 @@ namespace snake::state{
         this -> setWidgetsKeys();
         this -> packWidgets();
 
-        // Display the state
+        // Display the state, with the performance overlay on top
+        this -> game_window -> performance_overlay.frame( *this -> game_window );
         this -> game_window -> display();
     }
 
@@ -105,26 +114,20 @@ namespace snake::state{
      */
     void MenuState::drawImg(){
 
-        // Loading files from textures
-        if( ! this -> state_texture_1.loadFromFile( "img/images/logo.png" ) ){
-            this -> game_window -> close();
-        }
-        if( ! this -> state_texture_2.loadFromFile( "img/images/snake_branch.png" ) ){
-            this -> game_window -> close();
-        }
-        if( ! this -> state_texture_3.loadFromFile( "img/images/menu_background.jpg" ) ){
-            this -> game_window -> close();
-        }
+        // Textures, loaded once by the resource cache
+        const auto& logo_texture = utility::Resources::texture( "img/images/logo.png" );
+        const auto& snake_branch_texture = utility::Resources::texture( "img/images/snake_branch.png" );
+        const auto& menu_background_texture = utility::Resources::texture( "img/images/menu_background.jpg" );
 
         // Logo
-        this ->logo_sprite.setTexture( this -> state_texture_1 );
+        this ->logo_sprite.setTexture( logo_texture );
         this -> logo_sprite.setPosition( 
            ( this -> game_window_size_x - this -> logo_sprite.getGlobalBounds().width ) * 0.5f, 
            ( this -> game_window_size_y - this -> logo_sprite.getGlobalBounds().height ) * 0.2f
         );
 
         // Snake on the branch
-        this -> snake_branch_sprite.setTexture( this -> state_texture_2 );
+        this -> snake_branch_sprite.setTexture( snake_branch_texture );
         this -> snake_branch_sprite.setPosition( 
            0, 
            ( this -> game_window_size_y - this -> snake_branch_sprite.getGlobalBounds().height ) * 0.25f
@@ -132,7 +135,7 @@ namespace snake::state{
 
         // Background
         this -> background.setSize( sf::Vector2f( this -> game_window_size_x, this -> game_window_size_y ) );
-        this -> background.setTexture( &this -> state_texture_3, true );
+        this -> background.setTexture( &menu_background_texture, true );
 
         // Drawing the images
         this -> game_window -> draw( this -> background );
@@ -174,7 +177,7 @@ namespace snake::state{
         };
         auto game_action = [ this ]{
             this -> game_window -> game_window_states.insert( 
-                { "Game", std::make_shared<state::GameState>( state::GameState( this -> game_window ) ) } 
+                { "Game", std::make_shared<state::GameState>( this -> game_window ) } 
             );
         };
         this -> game_button -> setAction( game_action );
@@ -256,6 +259,9 @@ namespace snake::state{
             game_window_size_y * 0.90f 
         );
         this -> metadata.setCharacterSize( this -> text_size + 6 );
+
+        // Version number text
+        widget::Widget::updateText( this -> metadata, this -> font, "Current version: 1.0.0\nCopyright (c) 2022 Gianluca Bianco under the MIT license" );
     }
 
     //====================================================
@@ -325,10 +331,6 @@ namespace snake::state{
      */
     void MenuState::packWidgets(){
 
-        // Version number text
-        this -> metadata.setFont( this -> font );
-        this -> metadata.setString( "Current version: 1.0.0\nCopyright (c) 2022 Gianluca Bianco under the MIT license" );
-
         // Draw stuff
         this -> game_button -> pack( this -> game_window );
         this -> scores_button -> pack( this -> game_window );
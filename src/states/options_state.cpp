@@ -31,12 +31,21 @@
 
 // Widgets
 #include <widgets/textbox.hpp>
+#include <widgets/widget.hpp>
 
 // Debug
 #ifdef DEBUG_SNAKE_GAME
     #include <ptc/print.hpp>
 #endif
 
+// Utility
+#include <utility/resources.hpp>
+
+// Core
+#include <core/io_worker.hpp>
+#include <core/options.hpp>
+#include <core/trace.hpp>
+
 // SFML
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Rect.hpp>
@@ -49,14 +58,11 @@
 #include <SFML/System/Vector2.hpp>
 
 // STD
-#include <fstream>
 #include <cstdint>
-#include <algorithm>
 #include <filesystem>
+#include <iostream>
 #include <memory>
 #include <string>
-#include <string_view>
-#include <vector>
 
 namespace snake::state{
 
@@ -73,6 +79,8 @@ namespace snake::state{
         already_wrote_player( false ),
         already_wrote_speed( false ),
         already_wrote_background( false ),
+        saved_message_visible( false ),
+        options_changed( false ),
         options_file_path( this -> game_window -> options_file_path ){
 
         // Draw widgets
@@ -87,25 +95,74 @@ namespace snake::state{
      * 
      */
     void OptionsState::drawState() {
+        SNAKE_TRACE_SCOPE( "OptionsState::drawState" );
 
         // Clear the window
         this -> game_window -> clear( this -> background_color );
 
-        // Update player entry
-        this -> player_name_textbox -> updateText( this -> game_window -> game_event );
-        this -> snake_speed_textbox -> updateText( this -> game_window -> game_event );
-        this -> background_textbox -> updateText( this -> game_window -> game_event );
-
         // Drawing images
         this -> drawImg();
 
         // Drawing widgets
         this -> packWidgets();
 
-        // Display the state
+        // Display the state, with the performance overlay on top
+        this -> game_window -> performance_overlay.frame( *this -> game_window );
         this -> game_window -> display();
     }
 
+    //====================================================
+    //     updateState
+    //====================================================
+    /**
+     * @brief Method used to save the changed options once no other change has been made for a while.
+     * 
+     * @param elapsed The time passed since the previous frame.
+     */
+    void OptionsState::updateState( const sf::Time& ){
+        if( this -> options_changed && this -> options_clock.getElapsedTime() >= this -> save_delay ){
+            this -> saveOptions();
+        }
+    }
+
+    //====================================================
+    //     textEntered
+    //====================================================
+    /**
+     * @brief Method used to write a text entered in the window into the active textbox.
+     * 
+     * @param event The text entered event.
+     */
+    void OptionsState::textEntered( const sf::Event& event ){
+        this -> player_name_textbox -> updateText( event );
+        this -> snake_speed_textbox -> updateText( event );
+        this -> background_textbox -> updateText( event );
+    }
+
+    //====================================================
+    //     isAnimating
+    //====================================================
+    /**
+     * @brief Method used to know if a "Saved!" message is on screen, since it must be erased once its time is over, or if changed options are waiting to be saved.
+     * 
+     * @return true If a "Saved!" message is shown or a save is pending.
+     * @return false Otherwise.
+     */
+    bool OptionsState::isAnimating() const {
+        return this -> saved_message_visible || this -> options_changed;
+    }
+
+    //====================================================
+    //     leaveState
+    //====================================================
+    /**
+     * @brief Method used to save the changed options right away when the Options screen is left.
+     * 
+     */
+    void OptionsState::leaveState(){
+        this -> saveOptions();
+    }
+
     //====================================================
     //     drawImg
     //====================================================
@@ -115,26 +172,20 @@ namespace snake::state{
      */
     void OptionsState::drawImg() {
 
-        // Loading files from textures
-        if( ! state_texture_1.loadFromFile( "img/images/snake_branch.png" ) ){
-            this -> game_window -> close();
-        }
-        if( ! state_texture_2.loadFromFile( "img/images/menu_background.jpg" ) ){
-            this -> game_window -> close();
-        }
-        if( ! state_texture_3.loadFromFile( "img/images/settings_logo.png" ) ){
-            this -> game_window -> close();
-        }
+        // Textures, loaded once by the resource cache
+        const auto& snake_branch_texture = utility::Resources::texture( "img/images/snake_branch.png" );
+        const auto& menu_background_texture = utility::Resources::texture( "img/images/menu_background.jpg" );
+        const auto& settings_logo_texture = utility::Resources::texture( "img/images/settings_logo.png" );
 
         // Snake on the branch
-        this -> snake_branch_sprite.setTexture( this -> state_texture_1 );
+        this -> snake_branch_sprite.setTexture( snake_branch_texture );
         this -> snake_branch_sprite.setPosition( 
            0, 
            ( this -> game_window_size_y - this -> snake_branch_sprite.getGlobalBounds().height ) * 0.25f
         );
 
         // Settings logo
-        this -> settings_logo.setTexture( state_texture_3 );
+        this -> settings_logo.setTexture( settings_logo_texture );
         this -> settings_logo.setPosition( 
            ( this -> game_window_size_x - this -> settings_logo.getGlobalBounds().width ) * 0.5f,
            ( this -> game_window_size_y - this -> settings_logo.getGlobalBounds().height ) * 0.2f
@@ -142,7 +193,7 @@ namespace snake::state{
 
         // Background
         this -> background.setSize( sf::Vector2f( this -> game_window_size_x, this -> game_window_size_y ) );
-        this -> background.setTexture( &state_texture_2, true );
+        this -> background.setTexture( &menu_background_texture, true );
 
         // Drawing the images
         this -> game_window -> draw( this -> background );
@@ -271,46 +322,58 @@ namespace snake::state{
             this -> background_option.getPosition().y
         );
         this -> text_has_been_saved_background.setCharacterSize( this -> text_size + 6 );
+
+        // Back-to-menu text settings
+        widget::Widget::updateText( this -> back_to_menu, this -> font, "Press <Tab> to back to menu" );
+
+        // Text has been saved (player) settings
+        widget::Widget::updateText( this -> text_has_been_saved_player, this -> font, "Saved!" );
+
+        // Player option text settings
+        widget::Widget::updateText( this -> player_option, this -> font, "Change player name:" );
+
+        // Speed option text settings
+        widget::Widget::updateText( this -> speed_option, this -> font, "Change snake speed (default 25):" );
+
+        // Text has been saved (speed) settings
+        widget::Widget::updateText( this -> text_has_been_saved_speed, this -> font, "Saved!" );
+
+        // Background option text settings
+        widget::Widget::updateText( this -> background_option, this -> font, "Change game background (insert file path):" );
+
+        // Text has been saved (background) settings
+        widget::Widget::updateText( this -> text_has_been_saved_background, this -> font, "Saved!" );
     }
 
     //====================================================
-    //     fileUpdate
+    //     changeOptions
     //====================================================
     /**
-     * @brief Method used to update the options file.
+     * @brief Method used to note that the options of the window have been changed. Changes made close together are saved with a single write, once they settle.
      * 
-     * @param option The option to be modified.
-     * @param option_idx File index of the option to be modified.
      */
-    void OptionsState::fileUpdate( std::string_view option, uint16_t option_idx ){
-
-        // Clear stuff from previous iterations
-        this -> lines.clear();
-
-        // Variables
-        std::ifstream input_file( this -> options_file_path );
+    void OptionsState::changeOptions(){
+        this -> options_changed = true;
+        this -> options_clock.restart();
+    }
 
-        // Reading file lines
-        while( std::getline( input_file, this -> input ) ){
-            lines.push_back( this -> input );
+    //====================================================
+    //     saveOptions
+    //====================================================
+    /**
+     * @brief Method used to write the options of the window, which the next games use, to the options file on the I/O worker, if they have been changed.
+     * 
+     */
+    void OptionsState::saveOptions(){
+        if( this -> options_changed ){
+            window::GameWindow::io_worker.post( [ path = this -> options_file_path, options = this -> game_window -> options ](){
+                SNAKE_TRACE_SCOPE( "OptionsState::saveOptions" );
+                if( ! options.save( path ) ){
+                    std::cerr << "Cannot save the options to " << path.string() << "\n";
+                }
+            } );
+            this -> options_changed = false;
         }
-        
-        // Modifying the interested line
-        this -> lines.at( option_idx ) = option;
-        
-        // Close the input stream
-        input_file.close();
-
-        // Write updates in the output file
-        std::ofstream output_file( this -> options_file_path );
-        std::for_each(
-            this -> lines.begin(), 
-            this -> lines.end(), 
-            [ &output_file ]( auto& line ){ output_file << line << "\n"; } 
-        );
-        
-        // Close the output file
-        output_file.close();
     }
 
     //====================================================
@@ -321,34 +384,7 @@ namespace snake::state{
      * 
      */
     void OptionsState::packWidgets(){
-
-        // Back-to-menu text settings
-        this -> back_to_menu.setFont( this -> font );
-        this -> back_to_menu.setString( "Press <Tab> to back to menu" );
-
-        // Text has been saved (player) settings
-        this -> text_has_been_saved_player.setFont( this -> font );
-        this -> text_has_been_saved_player.setString( "Saved!" );
-
-        // Player option text settings
-        this -> player_option.setFont( this -> font );
-        this -> player_option.setString( "Change player name:" );
-
-        // Speed option text settings
-        this -> speed_option.setFont( this -> font );
-        this -> speed_option.setString( "Change snake speed (default 25):" );
-
-        // Text has been saved (speed) settings
-        this -> text_has_been_saved_speed.setFont( this -> font );
-        this -> text_has_been_saved_speed.setString( "Saved!" );
-
-        // Background option text settings
-        this -> background_option.setFont( this -> font );
-        this -> background_option.setString( "Change game background (insert file path):" );
-
-        // Text has been saved (background) settings
-        this -> text_has_been_saved_background.setFont( this -> font );
-        this -> text_has_been_saved_background.setString( "Saved!" );
+        this -> saved_message_visible = false;
 
         // Draw stuff
         this -> game_window -> draw( this -> back_to_menu );
@@ -362,48 +398,48 @@ namespace snake::state{
         // Player option
         if( this -> player_name_textbox -> saved_text != "" ){
 
-            // Write new options in file
-            this -> game_window -> player_option = this -> player_name_textbox -> saved_text;
-            if( this -> already_wrote_player == false ){
-                this -> fileUpdate( "Player: " + this -> player_name_textbox -> saved_text.substr( 0, this -> player_name_textbox -> saved_text.size() - 1 ), 0 );
+            // Change the options (the saved text ends with the cursor)
+            if( this -> already_wrote_player == false && this -> game_window -> options.setPlayer( this -> player_name_textbox -> saved_text.substr( 0, this -> player_name_textbox -> saved_text.size() - 1 ) ) ){
+                this -> changeOptions();
             }
             this -> already_wrote_player = true;
     
             // Draw temporary stuff
             if( this -> player_name_textbox -> deltaClock.getElapsedTime() < delta_time ){
                 this -> game_window -> draw( this -> text_has_been_saved_player );
+                this -> saved_message_visible = true;
             }
         }
 
         // Speed option
         if( this -> snake_speed_textbox -> saved_text != "" ){
 
-            // Write new options in file
-            this -> game_window -> speed_option = this -> snake_speed_textbox -> saved_text;
-            if( this -> already_wrote_speed == false ){
-                this -> fileUpdate( "SpeedPlus: " + this -> snake_speed_textbox -> saved_text.substr( 0, this -> snake_speed_textbox -> saved_text.size() - 1 ), 1 );
+            // Change the options (the saved text ends with the cursor)
+            if( this -> already_wrote_speed == false && this -> game_window -> options.setSpeed( this -> snake_speed_textbox -> saved_text.substr( 0, this -> snake_speed_textbox -> saved_text.size() - 1 ) ) ){
+                this -> changeOptions();
             }
             this -> already_wrote_speed = true;
     
             // Draw temporary stuff
             if( this -> snake_speed_textbox -> deltaClock.getElapsedTime() < delta_time ){
                 this -> game_window -> draw( this -> text_has_been_saved_speed );
+                this -> saved_message_visible = true;
             }
         }
 
         // Background option
         if( this -> background_textbox -> saved_text != "" ){
 
-            // Write new options in file
-            this -> game_window -> background_option = this -> background_textbox -> saved_text;
-            if( this -> already_wrote_background == false ){
-                this -> fileUpdate( "Background: " + this -> background_textbox -> saved_text.substr( 0, this -> background_textbox -> saved_text.size() - 1 ), 2 );
+            // Change the options (the saved text ends with the cursor)
+            if( this -> already_wrote_background == false && this -> game_window -> options.setBackground( this -> background_textbox -> saved_text.substr( 0, this -> background_textbox -> saved_text.size() - 1 ) ) ){
+                this -> changeOptions();
             }
             this -> already_wrote_background = true;
     
             // Draw temporary stuff
             if( this -> background_textbox -> deltaClock.getElapsedTime() < delta_time ){
                 this -> game_window -> draw( this -> text_has_been_saved_background );
+                this -> saved_message_visible = true;
             }
         }
     }
@@ -31,12 +31,19 @@
 
 // Widgets
 #include <widgets/button.hpp>
+#include <widgets/widget.hpp>
 
 // Debug
 #ifdef DEBUG_SNAKE_GAME
     #include <ptc/print.hpp>
 #endif
 
+// Utility
+#include <utility/resources.hpp>
+
+// Core
+#include <core/trace.hpp>
+
 // SFML
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Rect.hpp>
@@ -76,6 +83,7 @@ namespace snake::state{
      * 
      */
     void PauseState::drawState() {
+        SNAKE_TRACE_SCOPE( "PauseState::drawState" );
 
         // Clear the window
         this -> pause_window -> clear( this -> background_color );
@@ -100,14 +108,12 @@ namespace snake::state{
      */
     void PauseState::drawImg() const {
 
-        // Loading files from textures
-        if( ! state_texture_5.loadFromFile( "img/images/title_game_background.jpg" ) ){
-            this -> pause_window -> close();
-        }
+        // Textures, loaded once by the resource cache
+        const auto& title_game_background_texture = utility::Resources::texture( "img/images/title_game_background.jpg" );
 
         // Background
         sf::RectangleShape background( sf::Vector2f( this -> pause_window_size_x, this -> pause_window_size_y ) );
-        background.setTexture( &state_texture_5, true );
+        background.setTexture( &title_game_background_texture, true );
 
         // Drawing the images
         this -> pause_window -> draw( background );
@@ -182,6 +188,9 @@ namespace snake::state{
            ( this -> pause_window_size_x / 2 - this -> text.getGlobalBounds().width ) * 0.6f, 
            ( this -> pause_window_size_y / 2 - this -> text.getGlobalBounds().height ) * 0.4f
         );
+
+        // Text settings
+        widget::Widget::updateText( this -> text, this -> font, "Quit the game?" );
     }
 
     //====================================================
@@ -213,10 +222,6 @@ namespace snake::state{
      */
     void PauseState::packWidgets(){
 
-        // Text settings
-        this -> text.setFont( this -> font );
-        this -> text.setString( "Quit the game?" );
-
         // Draw stuff
         this -> yes_button -> pack( this -> pause_window );
         this -> no_button -> pack( this -> pause_window );
@@ -29,6 +29,16 @@
 #include <states/state.hpp>
 #include <states/scores_state.hpp>
 
+// Core
+#include <core/score_store.hpp>
+#include <core/trace.hpp>
+
+// Widgets
+#include <widgets/widget.hpp>
+
+// Utility
+#include <utility/resources.hpp>
+
 // SFML
 #include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
@@ -38,13 +48,10 @@
 #include <SFML/System/Vector2.hpp>
 
 // STD
-#include <fstream>
 #include <algorithm>
 #include <cstdint>
-#include <filesystem>
-#include <functional>
-#include <map>
-#include <new>
+#include <cstddef>
+#include <iterator>
 #include <string>
 #include <utility>
 #include <vector>
@@ -65,50 +72,13 @@ namespace snake::state{
         string_second( "" ),
         string_third( "" ){
 
-        // Compute best scores
-        this -> scores_map = this -> getScoresMap();
+        // Best scores, kept by the score store
+        this -> initStrings();
 
         // Draw widgets
         this -> drawWidgets();
     }
 
-    //====================================================
-    //     getScoresContainer
-    //====================================================
-    /**
-     * @brief Method used to get the scores container with also player names.
-     * 
-     */
-    std::multimap<uint64_t, std::string, std::greater<int64_t>> ScoresState::getScoresMap(){
-
-        // Read scores from file
-        std::ifstream score_file( this -> game_window -> score_file_path );
-        if( ! score_file ){
-            std::ofstream default_settings( this -> game_window -> score_file_path );
-            default_settings.close();
-        }
-        std::string score_line;
-        std::vector<std::string> lines;
-        while( std::getline( score_file, score_line ) ){
-            lines.push_back( score_line );
-        }
-
-        // Compute best score
-        std::multimap <uint64_t, std::string, std::greater<int64_t>> scores_map;
-        std::string player_name;
-        uint64_t player_score;
-        for( const auto& line: lines ){
-            std::stringstream words( line );
-            words >> player_score >> player_name;
-            scores_map.insert( { player_score, player_name } );
-        }
-
-        // Close stream
-        score_file.close();
-
-        return scores_map;
-    }
-
     //====================================================
     //     drawState
     //====================================================
@@ -117,6 +87,7 @@ namespace snake::state{
      * 
      */
     void ScoresState::drawState() {
+        SNAKE_TRACE_SCOPE( "ScoresState::drawState" );
 
         // Clear the window
         this -> game_window -> clear( this -> background_color );
@@ -128,7 +99,8 @@ namespace snake::state{
         this -> setWidgetsKeys();
         this -> packWidgets();
 
-        // Display the state
+        // Display the state, with the performance overlay on top
+        this -> game_window -> performance_overlay.frame( *this -> game_window );
         this -> game_window -> display();
     }
 
@@ -141,28 +113,16 @@ namespace snake::state{
      */
     void ScoresState::drawImg(){
 
-        // Loading files from textures
-        if( ! state_texture_1.loadFromFile( "img/images/snake_branch.png" ) ){
-            this -> game_window -> close();
-        }
-        if( ! state_texture_2.loadFromFile( "img/images/menu_background.jpg" ) ){
-            this -> game_window -> close();
-        }
-        if( ! state_texture_3.loadFromFile( "img/textures/gold_icon.png" ) ){
-            this -> game_window -> close();
-        }
-        if( ! state_texture_4.loadFromFile( "img/textures/silver_icon.png" ) ){
-            this -> game_window -> close();
-        }
-        if( ! state_texture_5.loadFromFile( "img/textures/bronze_icon.png" ) ){
-            this -> game_window -> close();
-        }
-        if( ! state_texture_6.loadFromFile( "img/images/scores_title.png" ) ){
-            this -> game_window -> close();
-        }
+        // Textures, loaded once by the resource cache
+        const auto& snake_branch_texture = utility::Resources::texture( "img/images/snake_branch.png" );
+        const auto& menu_background_texture = utility::Resources::texture( "img/images/menu_background.jpg" );
+        const auto& gold_icon_texture = utility::Resources::texture( "img/textures/gold_icon.png" );
+        const auto& silver_icon_texture = utility::Resources::texture( "img/textures/silver_icon.png" );
+        const auto& bronze_icon_texture = utility::Resources::texture( "img/textures/bronze_icon.png" );
+        const auto& scores_title_texture = utility::Resources::texture( "img/images/scores_title.png" );
 
         // Snake on the branch
-        this -> snake_branch_sprite.setTexture( this -> state_texture_1 );
+        this -> snake_branch_sprite.setTexture( snake_branch_texture );
         this -> snake_branch_sprite.setPosition( 
            0, 
            ( this -> game_window_size_y - snake_branch_sprite.getGlobalBounds().height ) * 0.25f
@@ -170,31 +130,31 @@ namespace snake::state{
 
         // Background
         this -> background.setSize( sf::Vector2f( this -> game_window_size_x, this -> game_window_size_y ) );
-        this -> background.setTexture( &this -> state_texture_2, true );
+        this -> background.setTexture( &menu_background_texture, true );
 
         // Title image
-        this -> title.setTexture( this -> state_texture_6 );
+        this -> title.setTexture( scores_title_texture );
         this -> title.setPosition( 
            ( this -> game_window_size_x * 0.5f - this -> title.getGlobalBounds().width * 0.5f ), 
            ( this -> game_window_size_y * 0.5f - this -> title.getGlobalBounds().height * 0.5f ) * 0.2f
         );
 
         // First award icon
-        this -> gold_trophy.setTexture( this -> state_texture_3 );
+        this -> gold_trophy.setTexture( gold_icon_texture );
         this -> gold_trophy.setPosition( 
            ( this -> game_window_size_x * 0.5f - this -> title.getGlobalBounds().width * 0.5f ), 
            ( this -> game_window_size_y * 0.5f - this -> gold_trophy.getGlobalBounds().height * 0.5f )
         );
 
         // Second award icon
-        this -> silver_trophy.setTexture( this -> state_texture_4 );
+        this -> silver_trophy.setTexture( silver_icon_texture );
         this -> silver_trophy.setPosition( 
            this -> gold_trophy.getPosition().x * 1.023f, 
            this -> gold_trophy.getPosition().y * 1.35f
         );
 
         // Third award icon
-        this -> bronze_trophy.setTexture( this -> state_texture_5 );
+        this -> bronze_trophy.setTexture( bronze_icon_texture );
         this -> bronze_trophy.setPosition( 
            this -> silver_trophy.getPosition().x, 
            this -> silver_trophy.getPosition().y * 1.225f
@@ -249,6 +209,18 @@ namespace snake::state{
             ( this -> game_window_size_y * 0.5f - this -> title.getGlobalBounds().height * 0.5f ) * 1.49f
         );
         this -> third_player.setCharacterSize( this -> text_size + 20 );
+
+        // Back-to-menu text settings
+        widget::Widget::updateText( this -> back_to_menu, this -> font, "Press <Tab> to back to menu, <S> for player statistics" );
+
+        // First award player name settings
+        widget::Widget::updateText( this -> first_player, this -> font, this -> string_first );
+
+        // Second award player name settings
+        widget::Widget::updateText( this -> second_player, this -> font, this -> string_second );
+
+        // Third award player name settings
+        widget::Widget::updateText( this -> third_player, this -> font, this -> string_third );
     }
 
     //====================================================
@@ -259,29 +231,12 @@ namespace snake::state{
      * 
      */
     void ScoresState::initStrings(){
-        try{
-            this -> iterator = this -> scores_map.begin();
-            this -> string_first = std::to_string( iterator -> first ) + "   " + iterator -> second;
-            try{
-                this -> iterator++;
-                this -> string_second = std::to_string( iterator -> first ) + "   " + iterator -> second;
-                try{
-                    this -> iterator++;
-                    this -> string_third = std::to_string( iterator -> first ) + "   " + iterator -> second;
-                }
-                catch( const std::bad_alloc& ){
-                    this -> string_third = "Empty";
-                }
-            }
-            catch( const std::bad_alloc& ){
-                this -> string_second = "Empty";
-                this -> string_third = "Empty";
-            }
-        }
-        catch( const std::bad_alloc& ){
-            this -> string_first = "Empty";
-            this -> string_second = "Empty";
-            this -> string_third = "Empty";
+        std::string* strings[] = { &this -> string_first, &this -> string_second, &this -> string_third };
+
+        // Fill the podium, leaving missing places empty
+        const auto& top_scores = this -> game_window -> score_store.top();
+        for( size_t place = 0; place < std::size( strings ); place++ ){
+            *strings[ place ] = place < top_scores.size() ? std::to_string( top_scores[ place ].score ) + "   " + top_scores[ place ].player : "Empty";
         }
     }
 
@@ -294,25 +249,6 @@ namespace snake::state{
      */
     void ScoresState::packWidgets(){
 
-        // Back-to-menu text settings
-        this -> back_to_menu.setFont( this -> font );
-        this -> back_to_menu.setString( "Press <Tab> to back to menu" );
-
-        // Modify strings
-        this -> initStrings();
-
-        // First award player name settings
-        this -> first_player.setFont( this -> font );
-        this -> first_player.setString( this -> string_first );
-
-        // Second award player name settings
-        this -> second_player.setFont( this -> font );
-        this -> second_player.setString( this -> string_second );
-
-        // Third award player name settings
-        this -> third_player.setFont( this -> font );
-        this -> third_player.setString( this -> string_third );
-
         // Draw stuff
         this -> game_window -> draw( this -> back_to_menu );
         this -> game_window -> draw( this -> first_player );
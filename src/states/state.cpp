@@ -15,28 +15,18 @@
 // States
 #include <states/state.hpp>
 
+// Utility
+#include <utility/resources.hpp>
+
 // SFML
-#include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Font.hpp>
+#include <SFML/System/Time.hpp>
 
 // STD
-#include <cstdlib>
 #include <memory> 
 
 namespace snake::state{
 
-    //====================================================
-    //     Static variables
-    //====================================================
-    sf::Texture State::state_texture_1;
-    sf::Texture State::state_texture_2;
-    sf::Texture State::state_texture_3;
-    sf::Texture State::state_texture_4;
-    sf::Texture State::state_texture_5;
-    sf::Texture State::state_texture_6;
-    sf::Texture State::state_texture_7;
-    sf::Font State::font;
-
     //====================================================
     //     State (constructor)
     //====================================================
@@ -44,10 +34,9 @@ namespace snake::state{
      * @brief Main constructor of the State class.
      * 
      */
-    State::State(){
-        if( ! this -> font.loadFromFile( "fonts/source-sans-pro/SourceSansPro-Semibold.otf" ) ){
-            std::exit( 0 );
-        };
+    State::State():
+        font( utility::Resources::font( "fonts/source-sans-pro/SourceSansPro-Semibold.otf" ) ){
+
     }
 
     //====================================================
@@ -61,6 +50,101 @@ namespace snake::state{
 
     }
 
+    //====================================================
+    //     updateState
+    //====================================================
+    /**
+     * @brief Method used to advance the current state logic by the time elapsed since the last frame. Static states do nothing.
+     * 
+     * @param elapsed Time elapsed since the last frame.
+     */
+    void State::updateState( const sf::Time& ){
+
+    }
+
+    //====================================================
+    //     keyPressed
+    //====================================================
+    /**
+     * @brief Method used to pass to the current state a key pressed in the window which has not been handled by the window itself.
+     * 
+     * @param event The key pressed event.
+     */
+    void State::keyPressed( const sf::Event& ){
+
+    }
+
+    //====================================================
+    //     textEntered
+    //====================================================
+    /**
+     * @brief Method used to pass to the current state a text entered in the window.
+     * 
+     * @param event The text entered event.
+     */
+    void State::textEntered( const sf::Event& ){
+
+    }
+
+    //====================================================
+    //     isStatic
+    //====================================================
+    /**
+     * @brief Method used to know if the state changes only in response to window events, so that it can be redrawn only when an event arrives.
+     * 
+     * @return true If the state is static.
+     * @return false If the state must be redrawn every frame.
+     */
+    bool State::isStatic() const {
+        return true;
+    }
+
+    //====================================================
+    //     isAnimating
+    //====================================================
+    /**
+     * @brief Method used to know if a static state is currently showing something which changes over time.
+     * 
+     * @return true If the state must be redrawn even without events.
+     * @return false Otherwise.
+     */
+    bool State::isAnimating() const {
+        return false;
+    }
+
+    //====================================================
+    //     leaveState
+    //====================================================
+    /**
+     * @brief Method called before the window showing the state is closed, so that the state can save what is still pending.
+     * 
+     */
+    void State::leaveState(){
+
+    }
+
+    //====================================================
+    //     pauseState
+    //====================================================
+    /**
+     * @brief Method called before the pause window is opened over the state.
+     * 
+     */
+    void State::pauseState(){
+
+    }
+
+    //====================================================
+    //     resumeState
+    //====================================================
+    /**
+     * @brief Method called when the state is shown again after the pause window has been closed.
+     * 
+     */
+    void State::resumeState(){
+
+    }
+
     //====================================================
     //     setWidgetsKeys
     //====================================================
@@ -0,0 +1,251 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file stats_state.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Windows
+#include <windows/game_window.hpp>
+
+// States
+#include <states/state.hpp>
+#include <states/stats_state.hpp>
+
+// Core
+#include <core/stats_store.hpp>
+#include <core/trace.hpp>
+
+// Widgets
+#include <widgets/widget.hpp>
+
+// Utility
+#include <utility/resources.hpp>
+
+// SFML
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+// STD
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace snake::state{
+
+    //====================================================
+    //     formatTime
+    //====================================================
+    /**
+     * @brief Function used to format a play time as hours, minutes and seconds.
+     *
+     * @param milliseconds The play time, in milliseconds.
+     * @return std::string The formatted play time (e.g. "1:02:03" or "2:03").
+     */
+    static std::string formatTime( uint64_t milliseconds ){
+        const uint64_t seconds = milliseconds / 1000;
+        std::ostringstream time;
+        if( seconds >= 3600 ){
+            time << seconds / 3600 << ":" << std::setw( 2 ) << std::setfill( '0' );
+        }
+        time << seconds / 60 % 60 << ":" << std::setw( 2 ) << std::setfill( '0' ) << seconds % 60;
+        return time.str();
+    }
+
+    //====================================================
+    //     StatsState (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the StatsState class.
+     *
+     * @param game_window The window to which the state stuff is constructed.
+     */
+    StatsState::StatsState( window::GameWindow* game_window ):
+        game_window( game_window ){
+
+        // Player statistics, kept by the statistics store
+        this -> initStrings();
+
+        // Draw widgets
+        this -> drawWidgets();
+    }
+
+    //====================================================
+    //     drawState
+    //====================================================
+    /**
+     * @brief Method used to draw the current state.
+     *
+     */
+    void StatsState::drawState() {
+        SNAKE_TRACE_SCOPE( "StatsState::drawState" );
+
+        // Clear the window
+        this -> game_window -> clear( this -> background_color );
+
+        // Drawing images
+        this -> drawImg();
+
+        // Drawing widgets
+        this -> setWidgetsKeys();
+        this -> packWidgets();
+
+        // Display the state, with the performance overlay on top
+        this -> game_window -> performance_overlay.frame( *this -> game_window );
+        this -> game_window -> display();
+    }
+
+    //====================================================
+    //     drawImg
+    //====================================================
+    /**
+     * @brief Method used to draw the images.
+     *
+     */
+    void StatsState::drawImg(){
+
+        // Textures, loaded once by the resource cache
+        const auto& snake_branch_texture = utility::Resources::texture( "img/images/snake_branch.png" );
+        const auto& menu_background_texture = utility::Resources::texture( "img/images/menu_background.jpg" );
+
+        // Snake on the branch
+        this -> snake_branch_sprite.setTexture( snake_branch_texture );
+        this -> snake_branch_sprite.setPosition(
+           0,
+           ( this -> game_window_size_y - snake_branch_sprite.getGlobalBounds().height ) * 0.25f
+        );
+
+        // Background
+        this -> background.setSize( sf::Vector2f( this -> game_window_size_x, this -> game_window_size_y ) );
+        this -> background.setTexture( &menu_background_texture, true );
+
+        // Drawing the images
+        this -> game_window -> draw( background );
+        this -> game_window -> draw( snake_branch_sprite );
+    }
+
+    //====================================================
+    //     drawWidgets
+    //====================================================
+    /**
+     * @brief Method used to draw widgets in the current state.
+     *
+     */
+    void StatsState::drawWidgets() {
+
+        // Title text
+        this -> title.setFillColor( this -> textColor );
+        this -> title.setCharacterSize( this -> text_size + 26 );
+        widget::Widget::updateText( this -> title, this -> font, "Player statistics" );
+        this -> title.setPosition(
+            this -> game_window_size_x * 0.5f - this -> title.getGlobalBounds().width * 0.5f,
+            this -> game_window_size_y * 0.1f
+        );
+
+        // Back-to-scores text
+        this -> back_to_scores.setFillColor( this -> textColor );
+        this -> back_to_scores.setPosition(
+            game_window_size_x * 0.03f,
+            game_window_size_y * 0.91f
+        );
+        this -> back_to_scores.setCharacterSize( this -> text_size + 6 );
+        widget::Widget::updateText( this -> back_to_scores, this -> font, "Press <S> to back to scores, <Tab> to back to menu" );
+
+        // Columns, one text per column so that rows are aligned
+        for( size_t column = 0; column < this -> columns.size(); column++ ){
+            this -> columns[ column ].setFillColor( this -> textColor );
+            this -> columns[ column ].setPosition(
+                game_window_size_x * column_positions[ column ],
+                game_window_size_y * 0.28f
+            );
+            this -> columns[ column ].setCharacterSize( this -> text_size + 8 );
+            widget::Widget::updateText( this -> columns[ column ], this -> font, this -> column_strings[ column ] );
+        }
+    }
+
+    //====================================================
+    //     initStrings
+    //====================================================
+    /**
+     * @brief Method used to initialize the statistics strings. The current player comes first, followed by the other players from the best score.
+     *
+     */
+    void StatsState::initStrings(){
+        const auto& stats_store = this -> game_window -> stats_store;
+
+        // Choose the players to be shown
+        const core::PlayerStats* current_player = stats_store.find( this -> game_window -> options.player );
+        std::vector<const core::PlayerStats*> players;
+        for( const auto& [ player, stats ]: stats_store.players() ){
+            if( &stats != current_player ){
+                players.push_back( &stats );
+            }
+        }
+        std::sort( players.begin(), players.end(), []( const core::PlayerStats* first, const core::PlayerStats* second ){
+            return first -> best != second -> best ? first -> best > second -> best : first -> player < second -> player;
+        } );
+        if( current_player ){
+            players.insert( players.begin(), current_player );
+        }
+        players.resize( std::min<size_t>( players.size(), max_players ) );
+
+        // Fill the columns, a row per player
+        for( size_t column = 0; column < this -> column_strings.size(); column++ ){
+            this -> column_strings[ column ] = headers[ column ];
+        }
+        for( const core::PlayerStats* stats: players ){
+            std::ostringstream mean, last_scores;
+            mean << std::fixed << std::setprecision( 1 ) << stats -> mean();
+            for( const uint64_t score: stats -> recent() ){
+                last_scores << score << "  ";
+            }
+            const std::string row[] = {
+                stats -> player,
+                std::to_string( stats -> games ),
+                std::to_string( stats -> best ),
+                mean.str(),
+                std::to_string( stats -> food ),
+                formatTime( stats -> play_time ),
+                last_scores.str()
+            };
+            for( size_t column = 0; column < this -> column_strings.size(); column++ ){
+                this -> column_strings[ column ] += "\n" + row[ column ];
+            }
+        }
+        if( players.empty() ){
+            this -> column_strings[ 0 ] += "\nNo games played yet";
+        }
+    }
+
+    //====================================================
+    //     packWidgets
+    //====================================================
+    /**
+     * @brief Method used to pack widgets in the current state.
+     *
+     */
+    void StatsState::packWidgets(){
+
+        // Draw stuff
+        this -> game_window -> draw( this -> title );
+        this -> game_window -> draw( this -> back_to_scores );
+        for( const auto& column: this -> columns ){
+            this -> game_window -> draw( column );
+        }
+    }
+}
@@ -0,0 +1,196 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file asset_loader.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Utility
+#include <utility/asset_loader.hpp>
+#include <utility/resources.hpp>
+
+// Core
+#include <core/trace.hpp>
+
+// SFML
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Config.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Time.hpp>
+
+// STD
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace snake::utility{
+
+    //====================================================
+    //     AssetLoader (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the AssetLoader class. It starts decoding the assets which are not cached yet.
+     *
+     * @param textures The paths of the textures to be loaded.
+     * @param fonts The paths of the fonts to be loaded.
+     * @param sound_buffers The paths of the sound buffers to be loaded.
+     */
+    AssetLoader::AssetLoader( const std::vector<std::string>& textures, const std::vector<std::string>& fonts, const std::vector<std::string>& sound_buffers ){
+        this -> add( Kind::Texture, textures );
+        this -> add( Kind::Font, fonts );
+        this -> add( Kind::SoundBuffer, sound_buffers );
+        if( this -> assets.empty() ){
+            return;
+        }
+
+        // Decode on the pool workers, without waiting for them
+        this -> pool.post( this -> assets.size(), [ this ]( uint32_t, uint64_t index ){
+            this -> decode( this -> assets[ index ] );
+            const std::lock_guard<std::mutex> lock( this -> mutex );
+            this -> ready.push_back( index );
+        } );
+    }
+
+    //====================================================
+    //     AssetLoader (destructor)
+    //====================================================
+    /**
+     * @brief Destructor of the AssetLoader class. Assets not decoded yet are skipped, then the workers are waited for.
+     *
+     */
+    AssetLoader::~AssetLoader(){
+        this -> cancelled = true;
+        this -> pool.wait();
+    }
+
+    //====================================================
+    //     upload
+    //====================================================
+    /**
+     * @brief Method used to move the decoded assets into the resource cache, creating their textures, fonts and sound buffers. It must be called by the thread owning the window context, and it stops once the time budget is over so that the caller can draw a frame.
+     *
+     * @param budget The maximum time to be spent.
+     * @return true If every asset is in the cache.
+     * @return false If some assets are still to be decoded or uploaded.
+     */
+    bool AssetLoader::upload( const sf::Time& budget ){
+        SNAKE_TRACE_SCOPE( "AssetLoader::upload" );
+        {
+            const std::lock_guard<std::mutex> lock( this -> mutex );
+            this -> pending.insert( this -> pending.end(), this -> ready.begin(), this -> ready.end() );
+            this -> ready.clear();
+        }
+
+        const sf::Clock upload_clock;
+        while( ! this -> pending.empty() && upload_clock.getElapsedTime() < budget ){
+            Asset& asset = this -> assets[ this -> pending.back() ];
+            this -> pending.pop_back();
+            if( ! asset.decoded ){
+                throw std::runtime_error( "Cannot load " + asset.path );
+            }
+
+            switch( asset.kind ){
+                case Kind::Texture:
+                    Resources::storeTexture( asset.path, asset.image );
+                    asset.image = sf::Image();
+                    break;
+                case Kind::Font:
+                    if( asset.packed ){
+                        Resources::font( asset.path );
+                    }
+                    else{
+                        Resources::storeFont( asset.path, std::move( asset.file ) );
+                    }
+                    break;
+                default:
+                    Resources::storeSoundBuffer( asset.path, asset.samples, asset.channel_count, asset.sample_rate );
+                    asset.samples = std::vector<sf::Int16>();
+                    break;
+            }
+            this -> uploaded++;
+        }
+
+        return this -> uploaded == this -> assets.size();
+    }
+
+    //====================================================
+    //     progress
+    //====================================================
+    /**
+     * @brief Getter used to get the fraction of assets already in the cache.
+     *
+     * @return float The progress, in [0, 1].
+     */
+    float AssetLoader::progress() const {
+        return this -> assets.empty() ? 1.f : static_cast<float>( this -> uploaded ) / this -> assets.size();
+    }
+
+    //====================================================
+    //     add
+    //====================================================
+    /**
+     * @brief Method used to add the assets of a kind which are not cached yet.
+     *
+     * @param kind The kind of the assets.
+     * @param paths The paths of the assets.
+     */
+    void AssetLoader::add( Kind kind, const std::vector<std::string>& paths ){
+        for( const auto& path: paths ){
+            if( ! Resources::cached( path ) ){
+                this -> assets.push_back( { kind, path, Resources::packed( path ), sf::Image(), {}, {}, 0, 0, false } );
+            }
+        }
+    }
+
+    //====================================================
+    //     decode
+    //====================================================
+    /**
+     * @brief Method run by the workers to decode an image or the samples of a sound, or to read the file of a font, which is parsed when uploaded. Packed fonts need no reading.
+     *
+     * @param asset The asset to be decoded.
+     */
+    void AssetLoader::decode( Asset& asset ) const {
+        if( this -> cancelled ){
+            return;
+        }
+        SNAKE_TRACE_SCOPE( "AssetLoader::decode", asset.path );
+
+        if( asset.kind == Kind::Texture ){
+            asset.decoded = asset.packed ? asset.image.loadFromMemory( asset.packed -> data(), asset.packed -> size() ) : asset.image.loadFromFile( asset.path );
+            return;
+        }
+        if( asset.kind == Kind::SoundBuffer ){
+            sf::InputSoundFile sound_file;
+            if( asset.packed ? sound_file.openFromMemory( asset.packed -> data(), asset.packed -> size() ) : sound_file.openFromFile( asset.path ) ){
+                asset.samples.resize( sound_file.getSampleCount() );
+                asset.channel_count = sound_file.getChannelCount();
+                asset.sample_rate = sound_file.getSampleRate();
+                asset.decoded = sound_file.read( asset.samples.data(), asset.samples.size() ) == asset.samples.size();
+            }
+            return;
+        }
+        if( asset.packed ){
+            asset.decoded = true;
+            return;
+        }
+        std::ifstream file( asset.path, std::ios::binary );
+        asset.file.assign( std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>() );
+        asset.decoded = file.eof() && ! asset.file.empty();
+    }
+}
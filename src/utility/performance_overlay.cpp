@@ -0,0 +1,172 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file performance_overlay.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Utility
+#include <utility/performance_overlay.hpp>
+#include <utility/resources.hpp>
+
+// Windows
+#include <windows/base_window.hpp>
+
+// Core
+#include <core/frame_profile.hpp>
+
+// SFML
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/System/Vector2.hpp>
+
+// STD
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+
+namespace snake::utility{
+
+    //====================================================
+    //     PerformanceOverlay (constructor)
+    //====================================================
+    /**
+     * @brief Constructor of the PerformanceOverlay class. The font is set once the asset loader has cached it.
+     *
+     */
+    PerformanceOverlay::PerformanceOverlay():
+        graph( sf::Triangles ),
+        sampled_loads( Resources::loads() ){
+        this -> text.setCharacterSize( this -> text_size );
+        this -> text.setFillColor( sf::Color::White );
+        this -> panel.setFillColor( sf::Color( 0, 0, 0, 160 ) );
+    }
+
+    //====================================================
+    //     frame
+    //====================================================
+    /**
+     * @brief Method used to record the time since the previous frame and the resources loaded during it and, if the overlay is visible, to draw it in the bottom left corner of the window. It must be called once per frame by the thread drawing the window, right before the frame is displayed.
+     *
+     * @param window The window to which the overlay is drawn.
+     */
+    void PerformanceOverlay::frame( window::BaseWindow& window ){
+        this -> profile.addFrame( this -> frame_clock.restart().asSeconds() );
+        const uint64_t loads = Resources::loads();
+        this -> frame_loads = loads - this -> sampled_loads;
+        this -> max_frame_loads = std::max( this -> max_frame_loads, this -> frame_loads );
+        this -> sampled_loads = loads;
+        if( ! this -> visible ){
+            return;
+        }
+
+        // Texts change a few times per second, so that they can be read
+        if( this -> refresh_clock.getElapsedTime().asSeconds() >= this -> refresh_time ){
+            this -> refreshText( window );
+            this -> refresh_clock.restart();
+        }
+
+        // Layout: texts above the frame time graph
+        const sf::FloatRect text_bounds = this -> text.getLocalBounds();
+        const float graph_width = core::FrameProfile::history_size * this -> bar_width;
+        const sf::Vector2f size(
+            std::max( graph_width, text_bounds.left + text_bounds.width ) + 2.f * this -> margin,
+            text_bounds.top + text_bounds.height + this -> graph_height + 3.f * this -> margin
+        );
+        const sf::Vector2f position( this -> margin, window.getSize().y - size.y - this -> margin );
+        this -> panel.setSize( size );
+        this -> panel.setPosition( position );
+        this -> text.setPosition( position.x + this -> margin, position.y + this -> margin );
+        this -> buildGraph();
+
+        // Draw stuff
+        sf::RenderStates graph_states;
+        graph_states.transform.translate( position.x + this -> margin, position.y + size.y - this -> margin - this -> graph_height );
+        window.draw( this -> panel );
+        window.draw( this -> text );
+        window.draw( this -> graph, graph_states );
+    }
+
+    //====================================================
+    //     setFont
+    //====================================================
+    /**
+     * @brief Setter used to set the font of the overlay texts.
+     *
+     * @param font The font.
+     */
+    void PerformanceOverlay::setFont( const sf::Font& font ){
+        this -> text.setFont( font );
+    }
+
+    //====================================================
+    //     refreshText
+    //====================================================
+    /**
+     * @brief Method used to write the current timings and counters into the overlay text. Resource loads are shown for the last frame and as the maximum per frame since the previous refresh, so that a single loading frame is not missed.
+     *
+     * @param window The window to which the overlay is drawn.
+     */
+    void PerformanceOverlay::refreshText( const window::BaseWindow& window ){
+        const double mean_frame_time = this -> profile.meanFrameTime();
+
+        std::ostringstream stream;
+        stream << std::fixed << std::setprecision( 1 )
+               << "FPS: " << ( mean_frame_time > 0.0 ? 1.0 / mean_frame_time : 0.0 )
+               << "   frame: " << mean_frame_time * 1000.0 << " ms (max " << this -> profile.maxFrameTime() * 1000.0 << " ms)\n"
+               << std::setprecision( 3 );
+        for( uint8_t i = 0; i < core::FrameProfile::phase_count; i++ ){
+            const auto phase = static_cast<core::Phase>( i );
+            stream << core::FrameProfile::phaseName( phase ) << ": " << this -> profile.phase( phase ) * 1000.0 << " ms\n";
+        }
+        stream << "Draw calls: " << window.frame_draw_calls << "\n"
+               << "Geometry rebuilds: " << window.frame_geometry_rebuilds << "\n"
+               << "Resource loads: " << this -> frame_loads << " per frame (max " << this -> max_frame_loads << ", " << this -> sampled_loads << " total)";
+
+        this -> text.setString( stream.str() );
+        this -> max_frame_loads = 0;
+    }
+
+    //====================================================
+    //     buildGraph
+    //====================================================
+    /**
+     * @brief Method used to write one bar per recent frame into the graph vertices, the newest on the right. Bars are green within the 60 FPS budget, yellow within twice the budget and red above it.
+     *
+     */
+    void PerformanceOverlay::buildGraph(){
+        const uint32_t frames = this -> profile.frames();
+        this -> graph.resize( frames * 6 );
+
+        for( uint32_t age = 0; age < frames; age++ ){
+            const double frame_time = this -> profile.frameTime( age );
+            const float height = static_cast<float>( std::min( frame_time / this -> graph_max_time, 1.0 ) ) * this -> graph_height;
+            const float right = ( core::FrameProfile::history_size - age ) * this -> bar_width;
+            const float left = right - this -> bar_width;
+            const float top = this -> graph_height - height;
+            const sf::Color color =
+                frame_time <= this -> frame_budget * 1.1 ? sf::Color::Green :
+                frame_time <= this -> frame_budget * 2.2 ? sf::Color::Yellow :
+                sf::Color::Red;
+
+            sf::Vertex* bar = &this -> graph[ age * 6 ];
+            bar[ 0 ] = sf::Vertex( sf::Vector2f( left, top ), color );
+            bar[ 1 ] = sf::Vertex( sf::Vector2f( right, top ), color );
+            bar[ 2 ] = sf::Vertex( sf::Vector2f( right, this -> graph_height ), color );
+            bar[ 3 ] = sf::Vertex( sf::Vector2f( left, top ), color );
+            bar[ 4 ] = sf::Vertex( sf::Vector2f( right, this -> graph_height ), color );
+            bar[ 5 ] = sf::Vertex( sf::Vector2f( left, this -> graph_height ), color );
+        }
+    }
+}
@@ -0,0 +1,246 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file resources.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Utility
+#include <utility/resources.hpp>
+
+// Core
+#include <core/asset_archive.hpp>
+#include <core/trace.hpp>
+
+// SFML
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+
+// STD
+#include <string>
+#include <unordered_map>
+#include <stdexcept>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+namespace snake::utility{
+
+    //====================================================
+    //     Static variables
+    //====================================================
+    core::AssetArchive Resources::archive; // Defined first, so that fonts reading from it are destroyed before it
+    std::unordered_map<std::string, sf::Texture> Resources::textures;
+    std::unordered_map<std::string, sf::Font> Resources::fonts;
+    std::unordered_map<std::string, sf::SoundBuffer> Resources::sound_buffers;
+    std::unordered_map<std::string, std::vector<char>> Resources::font_files;
+    std::atomic<uint64_t> Resources::load_count{ 0 };
+
+    //====================================================
+    //     mount
+    //====================================================
+    /**
+     * @brief Method used to open the asset archive from which resources are read. It must be called before any resource is loaded.
+     * 
+     * @param archive_path The archive file path.
+     * @return true If the archive has been opened.
+     * @return false If it cannot be opened, in which case resources are read from disk.
+     */
+    bool Resources::mount( const std::filesystem::path& archive_path ){
+        return archive.open( archive_path );
+    }
+
+    //====================================================
+    //     packed
+    //====================================================
+    /**
+     * @brief Method used to get the content of a file from the mounted asset archive. It can be called from any thread once the archive is mounted.
+     * 
+     * @param path The file path.
+     * @return std::optional<std::string_view> The file content, or nothing if the file is not packed.
+     */
+    std::optional<std::string_view> Resources::packed( const std::string& path ){
+        return archive.find( path );
+    }
+
+    //====================================================
+    //     texture
+    //====================================================
+    /**
+     * @brief Method used to get a texture, loading it the first time it is asked.
+     * 
+     * @param path The texture file path.
+     * @return const sf::Texture& The cached texture.
+     */
+    const sf::Texture& Resources::texture( const std::string& path ){
+        return load( textures, path );
+    }
+
+    //====================================================
+    //     font
+    //====================================================
+    /**
+     * @brief Method used to get a font, loading it the first time it is asked.
+     * 
+     * @param path The font file path.
+     * @return const sf::Font& The cached font.
+     */
+    const sf::Font& Resources::font( const std::string& path ){
+        return load( fonts, path );
+    }
+
+    //====================================================
+    //     soundBuffer
+    //====================================================
+    /**
+     * @brief Method used to get a sound buffer, loading it the first time it is asked.
+     * 
+     * @param path The sound file path.
+     * @return const sf::SoundBuffer& The cached sound buffer.
+     */
+    const sf::SoundBuffer& Resources::soundBuffer( const std::string& path ){
+        return load( sound_buffers, path );
+    }
+
+    //====================================================
+    //     loads
+    //====================================================
+    /**
+     * @brief Method used to get how many resources have been loaded from file so far. It can be read from any thread.
+     * 
+     * @return uint64_t The number of loads.
+     */
+    uint64_t Resources::loads(){
+        return load_count.load( std::memory_order_relaxed );
+    }
+
+    //====================================================
+    //     cached
+    //====================================================
+    /**
+     * @brief Method used to know if a resource is already in one of the caches.
+     * 
+     * @param path The resource file path.
+     * @return true If the resource has been loaded.
+     * @return false Otherwise.
+     */
+    bool Resources::cached( const std::string& path ){
+        return textures.count( path ) || fonts.count( path ) || sound_buffers.count( path );
+    }
+
+    //====================================================
+    //     storeTexture
+    //====================================================
+    /**
+     * @brief Method used to create a cached texture from an image decoded elsewhere. It must be called by the thread owning the window context.
+     * 
+     * @param path The texture file path.
+     * @param image The decoded image.
+     */
+    void Resources::storeTexture( const std::string& path, const sf::Image& image ){
+        insert( textures, path, [ &image ]( sf::Texture& texture ){ return texture.loadFromImage( image ); } );
+    }
+
+    //====================================================
+    //     storeFont
+    //====================================================
+    /**
+     * @brief Method used to create a cached font from the content of its file. The font reads glyphs from that content while in use, so it is kept too.
+     * 
+     * @param path The font file path.
+     * @param file The content of the font file.
+     */
+    void Resources::storeFont( const std::string& path, std::vector<char> file ){
+        if( fonts.count( path ) ){
+            return;
+        }
+        const std::vector<char>& data = font_files[ path ] = std::move( file );
+        insert( fonts, path, [ &data ]( sf::Font& font ){ return font.loadFromMemory( data.data(), data.size() ); } );
+    }
+
+    //====================================================
+    //     storeSoundBuffer
+    //====================================================
+    /**
+     * @brief Method used to create a cached sound buffer from its decoded samples.
+     * 
+     * @param path The sound file path.
+     * @param samples The decoded samples, interleaved by channel.
+     * @param channel_count The number of channels.
+     * @param sample_rate The number of samples per second.
+     */
+    void Resources::storeSoundBuffer( const std::string& path, const std::vector<sf::Int16>& samples, uint32_t channel_count, uint32_t sample_rate ){
+        insert( sound_buffers, path, [ &samples, channel_count, sample_rate ]( sf::SoundBuffer& sound_buffer ){ 
+            return sound_buffer.loadFromSamples( samples.data(), samples.size(), channel_count, sample_rate ); 
+        } );
+    }
+
+    //====================================================
+    //     load
+    //====================================================
+    /**
+     * @brief Method used to look a resource up in its cache, loading it on a miss from the asset archive or, if it is not packed, from file. Elements of an unordered map never move, so the returned reference is stable.
+     * 
+     * @tparam T The resource type.
+     * @param cache The cache of the resource type.
+     * @param path The resource file path.
+     * @return const T& The cached resource.
+     */
+    template <typename T>
+    const T& Resources::load( std::unordered_map<std::string, T>& cache, const std::string& path ){
+        if( const auto found = cache.find( path ); found != cache.end() ){
+            return found -> second;
+        }
+
+        // Load in place, since SFML resources cannot be moved
+        SNAKE_TRACE_SCOPE( "Resources::load", path );
+        T& resource = cache[ path ];
+        const auto file = archive.find( path );
+        if( file ? ! resource.loadFromMemory( file -> data(), file -> size() ) : ! resource.loadFromFile( path ) ){
+            cache.erase( path );
+            throw std::runtime_error( "Cannot load " + path );
+        }
+        load_count.fetch_add( 1, std::memory_order_relaxed );
+        return resource;
+    }
+
+    //====================================================
+    //     insert
+    //====================================================
+    /**
+     * @brief Method used to add a resource to its cache, unless it is already there.
+     * 
+     * @tparam T The resource type.
+     * @tparam Loader The type of the function loading the resource.
+     * @param cache The cache of the resource type.
+     * @param path The resource file path.
+     * @param load_resource The function loading the resource in place, returning false on failure.
+     */
+    template <typename T, typename Loader>
+    void Resources::insert( std::unordered_map<std::string, T>& cache, const std::string& path, Loader load_resource ){
+        if( cache.count( path ) ){
+            return;
+        }
+
+        SNAKE_TRACE_SCOPE( "Resources::insert", path );
+        T& resource = cache[ path ];
+        if( ! load_resource( resource ) ){
+            cache.erase( path );
+            throw std::runtime_error( "Cannot load " + path );
+        }
+        load_count.fetch_add( 1, std::memory_order_relaxed );
+    }
+}
@@ -26,6 +26,9 @@
 #include <widgets/widget.hpp>
 #include <widgets/button.hpp>
 
+// Utility
+#include <utility/resources.hpp>
+
 // SFML
 #include <SFML/Graphics/Color.hpp>
 #include <SFML/Graphics/Rect.hpp>
@@ -126,21 +129,21 @@ namespace snake::widget{
         // Switch cases for button states
         switch( this -> widgetState ){
             case WDGT_IDLE:
-                this -> shape.setFillColor( this -> idleColor );
+                this -> setShapeColor( this -> idleColor );
                 break;
 
             case WDGT_HOVER:
-                this -> shape.setFillColor( this -> hoverColor );
+                this -> setShapeColor( this -> hoverColor );
                 break;
 
             case WDGT_ACTIVE:
-                this -> shape.setFillColor( this -> activeColor );
+                this -> setShapeColor( this -> activeColor );
                 this -> button_click_sound.play();
                 this -> action();
                 break;
 
             default:
-                this -> shape.setFillColor( sf::Color::Red );
+                this -> setShapeColor( sf::Color::Red );
                 break;
         }
     }
@@ -179,11 +182,9 @@ namespace snake::widget{
     void Button::loadSounds(){
 
         // Button click
-        this -> widget_sound_1.loadFromFile( "sounds/effects/button_click.wav" );
-        this -> button_click_sound.setBuffer( this -> widget_sound_1 );
+        this -> button_click_sound.setBuffer( utility::Resources::soundBuffer( "sounds/effects/button_click.wav" ) );
 
         // Button switch
-        this -> widget_sound_2.loadFromFile( "sounds/effects/button_switch.wav" );
-        this -> button_switch_sound.setBuffer( this -> widget_sound_2 );
+        this -> button_switch_sound.setBuffer( utility::Resources::soundBuffer( "sounds/effects/button_switch.wav" ) );
     }
 }
@@ -26,6 +26,9 @@
 #include <widgets/widget.hpp>
 #include <widgets/textbox.hpp>
 
+// Utility
+#include <utility/resources.hpp>
+
 // Debug
 #ifdef DEBUG_SNAKE_GAME
     #include <ptc/print.hpp>
@@ -118,26 +121,26 @@ namespace snake::widget{
         switch( this -> widgetState ){
             case WDGT_IDLE:
                 if( text.getString() == "|" ){
-                    this -> text.setString( "" );
+                    this -> setString( "" );
                 }
                 else if( text.getString().getSize() > 1 && text.getString()[ text.getString().getSize() - 1 ] == '|' ){
-                    this -> text.setString( text.getString().substring( 0, text.getString().getSize() - 1 ) );
+                    this -> setString( text.getString().substring( 0, text.getString().getSize() - 1 ) );
                 }
-                this -> shape.setFillColor( this -> idleColor );
+                this -> setShapeColor( this -> idleColor );
                 break;
 
             case WDGT_HOVER:
-                this -> shape.setFillColor( this -> hoverColor );
+                this -> setShapeColor( this -> hoverColor );
                 break;
 
             case WDGT_ACTIVE:
                 if( text.getString() == "" ){
-                    this -> text.setString( "|" );
+                    this -> setString( "|" );
                 }
                 else if( text.getString().getSize() > 1 && text.getString()[ text.getString().getSize() - 1 ] != '|' ){
-                    this -> text.setString( text.getString() + "|" );
+                    this -> setString( text.getString() + "|" );
                 }
-                this -> shape.setFillColor( this -> activeColor );
+                this -> setShapeColor( this -> activeColor );
                 if( sf::Keyboard::isKeyPressed( sf::Keyboard::Return ) ){
                     this -> saved_text = this -> text.getString();
                     this -> deltaClock.restart();
@@ -145,7 +148,7 @@ namespace snake::widget{
                 break;
 
             default:
-                this -> shape.setFillColor( sf::Color::Red );
+                this -> setShapeColor( sf::Color::Red );
                 break;
         }
     }
@@ -168,7 +171,7 @@ namespace snake::widget{
                         this -> delete_text_sound.play();
                         this -> current_text = this -> text.getString();
                         if( this -> current_text.size() > 1 ){
-                            this -> text.setString( this -> current_text.erase( this -> current_text.size() - 2, 1 ) );
+                            this -> setString( this -> current_text.erase( this -> current_text.size() - 2, 1 ) );
                             this -> input = this -> current_text.erase( this ->current_text.size() - 1, 1 );
                         }
                         break;
@@ -179,7 +182,7 @@ namespace snake::widget{
                         this -> write_text_sound.play();
                         this -> input += event.text.unicode;
                         this -> input_text.setString( this -> input );
-                        this -> text.setString( this -> input_text.getString() + "|" );
+                        this -> setString( this -> input_text.getString() + "|" );
                         break;
                     }
                 }
@@ -197,11 +200,9 @@ namespace snake::widget{
     void Textbox::loadSounds(){
 
         // Write text
-        this -> widget_sound_2.loadFromFile( "sounds/effects/write_text.wav" );
-        this -> write_text_sound.setBuffer( this -> widget_sound_2 );
+        this -> write_text_sound.setBuffer( utility::Resources::soundBuffer( "sounds/effects/write_text.wav" ) );
 
         // Delete text
-        this -> widget_sound_3.loadFromFile( "sounds/effects/delete_text.wav" );
-        this -> delete_text_sound.setBuffer( this -> widget_sound_3 );
+        this -> delete_text_sound.setBuffer( utility::Resources::soundBuffer( "sounds/effects/delete_text.wav" ) );
     }
 }
\ No newline at end of file
@@ -17,16 +17,17 @@
 
 // SFML
 #include <SFML/Graphics/Rect.hpp>
-#include <SFML/Audio/SoundBuffer.hpp>
+
+// STD
+#include <atomic>
+#include <cstdint>
 
 namespace snake::widget{
 
     //====================================================
     //     Static variables
     //====================================================
-    sf::SoundBuffer Widget::widget_sound_1;
-    sf::SoundBuffer Widget::widget_sound_2;
-    sf::SoundBuffer Widget::widget_sound_3;
+    std::atomic<uint32_t> Widget::geometry_rebuilds{ 0 };
 
     //====================================================
     //     Widget (constructor)
@@ -73,7 +74,7 @@ namespace snake::widget{
     //     centering
     //====================================================
     /**
-     * @brief Method used to center the text position into the shape.
+     * @brief Method used to center the text position into the shape. It is run only after the text changed, since measuring the text rebuilds its glyph geometry.
      * 
      */
     void Widget::centering(){
@@ -81,6 +82,71 @@ namespace snake::widget{
             this -> shape.getPosition().x + ( this -> shape.getGlobalBounds().width / 2.f ) - ( this -> text.getGlobalBounds().width / 2.f ),
             this -> shape.getPosition().y + ( this -> shape.getGlobalBounds().height / 2.f ) - ( this -> text.getGlobalBounds().height / 2.f ) - this -> text.getCharacterSize() / 4
         );
+        this -> layout_dirty = false;
+        this -> geometry_rebuilds.fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    //====================================================
+    //     setString
+    //====================================================
+    /**
+     * @brief Method used to change the widget text, marking its layout as dirty only if the text actually changed.
+     * 
+     * @param string The new text.
+     */
+    void Widget::setString( const sf::String& string ){
+        if( this -> text.getString() != string ){
+            this -> text.setString( string );
+            this -> layout_dirty = true;
+        }
+    }
+
+    //====================================================
+    //     updateText
+    //====================================================
+    /**
+     * @brief Method used by the states to change the string of a text which is not part of a widget. Its glyph geometry is rebuilt, and counted, only if the string actually changed.
+     * 
+     * @param text The text.
+     * @param string The new string.
+     */
+    void Widget::updateText( sf::Text& text, const sf::String& string ){
+        if( text.getString() != string ){
+            text.setString( string );
+            geometry_rebuilds.fetch_add( 1, std::memory_order_relaxed );
+        }
+    }
+
+    //====================================================
+    //     updateText
+    //====================================================
+    /**
+     * @brief Method used by the states to change the font and the string of a text which is not part of a widget. Its glyph geometry is rebuilt, and counted, only if one of them actually changed.
+     * 
+     * @param text The text.
+     * @param font The new font.
+     * @param string The new string.
+     */
+    void Widget::updateText( sf::Text& text, const sf::Font& font, const sf::String& string ){
+        if( text.getFont() != &font || text.getString() != string ){
+            text.setFont( font );
+            text.setString( string );
+            geometry_rebuilds.fetch_add( 1, std::memory_order_relaxed );
+        }
+    }
+
+    //====================================================
+    //     setShapeColor
+    //====================================================
+    /**
+     * @brief Method used to change the widget fill color, only if it actually changed.
+     * 
+     * @param color The new fill color.
+     */
+    void Widget::setShapeColor( const sf::Color& color ){
+        if( this -> shape.getFillColor() != color ){
+            this -> shape.setFillColor( color );
+        }
     }
 
     //====================================================
@@ -92,7 +158,10 @@ namespace snake::widget{
      * @param size The new size to be set.
      */
     void Widget::setTextSize( uint32_t size ){
-        this -> text.setCharacterSize( size );
+        if( this -> text.getCharacterSize() != size ){
+            this -> text.setCharacterSize( size );
+            this -> layout_dirty = true;
+        }
     }
 
     //====================================================
@@ -130,4 +199,16 @@ namespace snake::widget{
     void Widget::setTextColor( const sf::Color& color ){
         this -> text.setFillColor( color );
     }
+
+    //====================================================
+    //     setText
+    //====================================================
+    /**
+     * @brief Method used to set the text of the widget.
+     * 
+     * @param text The new text to be set.
+     */
+    void Widget::setText( std::string text ){
+        this -> setString( text );
+    }
 }
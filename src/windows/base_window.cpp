@@ -12,9 +12,24 @@
 //     Headers
 //====================================================
 
-// States
+// Windows
 #include <windows/base_window.hpp>
 
+// States
+#include <states/state.hpp>
+
+// Widgets
+#include <widgets/widget.hpp>
+
+// SFML
+#include <SFML/Window/Event.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/System/Sleep.hpp>
+#include <SFML/System/Time.hpp>
+
+// STD
+#include <atomic>
+
 namespace snake::window{
 
     //====================================================
@@ -28,4 +43,47 @@ namespace snake::window{
 
     }
 
+    //====================================================
+    //     display
+    //====================================================
+    /**
+     * @brief Method used to display the frame drawn so far, keeping its number of draw calls and of widget geometry rebuilds.
+     * 
+     */
+    void BaseWindow::display(){
+        this -> frame_draw_calls = this -> draw_calls;
+        this -> draw_calls = 0;
+        this -> frame_geometry_rebuilds = widget::Widget::geometry_rebuilds.exchange( 0, std::memory_order_relaxed );
+        sf::RenderWindow::display();
+    }
+
+    //====================================================
+    //     waitStateEvent
+    //====================================================
+    /**
+     * @brief Method used to sleep until the window receives an event, so that static states are not redrawn when nothing happens. If the state is animating, the wait ends after one idle frame anyway: since SFML 2.5 has no timed waitEvent, the window is polled in short sleeps.
+     * 
+     * @param event The event to be filled.
+     * @param state The state currently shown in the window.
+     * @return true If an event has been received.
+     * @return false If the wait timed out or the window has been closed.
+     */
+    bool BaseWindow::waitStateEvent( sf::Event& event, const state::State& state ){
+
+        // Nothing changes on screen: block until the next event
+        if( ! state.isAnimating() ){
+            return this -> waitEvent( event );
+        }
+
+        // Something changes on screen: wait at most one idle frame
+        const sf::Clock wait_clock;
+        while( ! this -> pollEvent( event ) ){
+            if( wait_clock.getElapsedTime() >= sf::milliseconds( this -> idle_frame_time ) ){
+                return false;
+            }
+            sf::sleep( sf::milliseconds( this -> idle_poll_time ) );
+        }
+        return true;
+    }
+
 }
\ No newline at end of file
@@ -28,16 +28,28 @@
 
 // States
 #include <states/menu_state.hpp>
+#include <states/scores_state.hpp>
+#include <states/stats_state.hpp>
 #include <states/state.hpp>
 
 // Utility
 #include <utility/gui.hpp>
+#include <utility/resources.hpp>
+#include <utility/asset_loader.hpp>
+
+// Core
+#include <core/game_files.hpp>
+#include <core/options.hpp>
+#include <core/trace.hpp>
 
 // SFML
 #include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
 #include <SFML/Window/VideoMode.hpp>
 #include <SFML/Audio/SoundBuffer.hpp>
 
@@ -55,13 +67,16 @@
 #include <filesystem>
 #include <fstream>
 #include <algorithm>
+#include <optional>
 
 namespace snake::window{
 
     //====================================================
     //     Static variables
     //====================================================
-    sf::SoundBuffer GameWindow::window_sound_1;
+    std::optional<uint64_t> GameWindow::seed_option;
+    std::optional<std::filesystem::path> GameWindow::replay_option;
+    core::IoWorker GameWindow::io_worker;
 
     //====================================================
     //     GameWindow
@@ -71,13 +86,21 @@ namespace snake::window{
      * 
      */
     GameWindow::GameWindow(){
+
+        // Finish the writes of the previous window before its files are read again
+        io_worker.flush();
     
         // Initialize window parameters
         this -> create( utility::getDesktopMode(), "Snake Game" );
 
         // Setting the icon
         auto icon = sf::Image{};
-        icon.loadFromFile( "img/images/logo_icon.png" );
+        if( const auto icon_file = utility::Resources::packed( "img/images/logo_icon.png" ) ){
+            icon.loadFromMemory( icon_file -> data(), icon_file -> size() );
+        }
+        else{
+            icon.loadFromFile( "img/images/logo_icon.png" );
+        }
         this -> setIcon( icon.getSize().x, icon.getSize().y, icon.getPixelsPtr() );
     
         // Other settings
@@ -86,10 +109,18 @@ namespace snake::window{
                 this -> desktop.height * 0.5 - this -> getSize().y * 0.5 
             ) 
         );
+        this -> setVerticalSyncEnabled( true );
+        this -> mouse_position = sf::Mouse::getPosition( *this );
 
         // Create game files
         this -> createGameFiles();
 
+        // Load assets behind a progress bar
+        this -> loadAssets();
+        if( ! this -> isOpen() ){
+            return;
+        }
+
         // Load sounds
         this -> loadSounds();
 
@@ -97,19 +128,44 @@ namespace snake::window{
         this -> game_window_states.insert( { "Menu", std::make_shared<state::MenuState>( state::MenuState( this ) ) } );
 
         // Init variables
-        this -> scores_container = this -> getScoresContainer();
+        this -> openScoreStore();
 
         // Display the window
         while( this -> isOpen() ){
+            SNAKE_TRACE_SCOPE( "GameWindow::frame" );
+
+            // Static states already on screen sleep until something happens, unless the performance overlay is measuring their frames
+            const auto shown_state = this -> game_window_states.begin() -> second;
+            if( shown_state -> isStatic() && shown_state.get() == this -> drawn_state && ! this -> performance_overlay.visible ){
+                SNAKE_TRACE_SCOPE( "GameWindow::idle" );
+                if( this -> waitStateEvent( this -> game_event, *shown_state ) ){
+                    processEvent( this -> game_event );
+                }
+                this -> frame_clock.restart();
+            }
 
             // Run the window event
             runWindow();
 
-            // Draw the first element of the states map
-            this -> game_window_states.begin() -> second -> drawState();
+            // Update and draw the first element of the states map
+            const auto current_state = this -> game_window_states.begin() -> second;
+            current_state -> updateState( this -> frame_clock.restart() );
+            current_state -> drawState();
+            this -> drawn_state = current_state.get();
         }
     }
 
+    //====================================================
+    //     GameWindow (destructor)
+    //====================================================
+    /**
+     * @brief Destructor of the GameWindow class. It waits for the pending writes, which may use the score store of the window.
+     * 
+     */
+    GameWindow::~GameWindow(){
+        io_worker.flush();
+    }
+
     //====================================================
     //     runWindow
     //====================================================
@@ -118,27 +174,50 @@ namespace snake::window{
      * 
      */
     void GameWindow::runWindow(){
+        SNAKE_TRACE_SCOPE( "GameWindow::runWindow" );
         
         // Check events of the main window
         while( this -> pollEvent( game_event ) ){
+            processEvent( game_event );
+        }
+    }
+
+    //====================================================
+    //     processEvent
+    //====================================================
+    /**
+     * @brief Method used to handle an event of the main window.
+     * 
+     * @param event The event to be handled.
+     */
+    void GameWindow::processEvent( const sf::Event& event ){
         
-            // Handling different events
-            switch( game_event.type ){
-            
-                // Window closing
-                case sf::Event::Closed:
-                    eventClosed();
-                    break;
-                        
-                // Key pressed in window
-                case sf::Event::KeyPressed:
-                    eventKeyPressed( game_event );
-                    break;
-    
-                // Default cases
-                default:
-                    break;
-            }
+        // Handling different events
+        switch( event.type ){
+        
+            // Window closing
+            case sf::Event::Closed:
+                eventClosed();
+                break;
+                    
+            // Key pressed in window
+            case sf::Event::KeyPressed:
+                eventKeyPressed( event );
+                break;
+
+            // Text entered in window
+            case sf::Event::TextEntered:
+                this -> game_window_states.begin() -> second -> textEntered( event );
+                break;
+
+            // Mouse moved in window, used by widgets hover state
+            case sf::Event::MouseMoved:
+                this -> mouse_position = sf::Vector2i( event.mouseMove.x, event.mouseMove.y );
+                break;
+
+            // Default cases
+            default:
+                break;
         }
     }
 
@@ -151,14 +230,17 @@ namespace snake::window{
      */
     void GameWindow::eventClosed(){
 
-        // Menu  / Options / Scores state
-        if( game_window_states.begin() -> first == "Menu" || game_window_states.begin() -> first == "Options" || game_window_states.begin() -> first == "Scores" ){
+        // Menu  / Options / Scores / Stats state
+        if( game_window_states.begin() -> first == "Menu" || game_window_states.begin() -> first == "Options" || game_window_states.begin() -> first == "Scores" || game_window_states.begin() -> first == "Stats" ){
+            this -> game_window_states.begin() -> second -> leaveState();
             this -> close();
         }
 
         // Game state
         else if( game_window_states.begin() -> first == "Game" ){
+            this -> game_window_states.begin() -> second -> pauseState();
             auto pause_window{ PauseWindow( "Pause" ) };
+            this -> game_window_states.begin() -> second -> resumeState();
         }
     }
 
@@ -171,6 +253,12 @@ namespace snake::window{
      */
     void GameWindow::eventKeyPressed( const sf::Event& event ){
 
+        // Performance overlay, in every state
+        if( event.key.code == sf::Keyboard::F3 ){ // F3
+            this -> performance_overlay.visible = ! this -> performance_overlay.visible;
+            return;
+        }
+
         // Menu  / Options / Scores state
         if( game_window_states.begin() -> first == "Menu" ){
             switch( event.key.code ){
@@ -187,26 +275,33 @@ namespace snake::window{
         else if( game_window_states.begin() -> first == "Game" ){
             switch( event.key.code ){
                 case sf::Keyboard::Escape:{ // Esc
+                    this -> game_window_states.begin() -> second -> pauseState();
                     this -> open_pause_window_sound.play();
                     auto pause_window{ PauseWindow( "Pause" ) };
                     if( pause_window.back_to_menu == true ) {
                         this -> game_window_states.erase( "Game" );
                     }
+                    else{
+                        this -> game_window_states.begin() -> second -> resumeState();
+                    }
                     break;
                 }
                 default:
+                    this -> game_window_states.begin() -> second -> keyPressed( event );
                     break;
             }
         }
 
-        // Options state
+        // Options state (pending options are saved before a new window reads them)
         else if( game_window_states.begin() -> first == "Options" ){
             switch( event.key.code ){
                 case sf::Keyboard::Escape:{ // ESC
+                    this -> game_window_states.begin() -> second -> leaveState();
                     this -> close();
                     break;
                 }
                 case sf::Keyboard::Tab:{ // Tab
+                    this -> game_window_states.begin() -> second -> leaveState();
                     this -> close();
                     auto game_window{ GameWindow() };
                     break;
@@ -216,8 +311,8 @@ namespace snake::window{
             }
         }
 
-        // Scores state
-        else if( game_window_states.begin() -> first == "Scores" ){
+        // Scores / Stats state
+        else if( game_window_states.begin() -> first == "Scores" || game_window_states.begin() -> first == "Stats" ){
             switch( event.key.code ){
                 case sf::Keyboard::Escape:{ // ESC
                     this -> close();
@@ -228,6 +323,16 @@ namespace snake::window{
                     auto game_window{ GameWindow() };
                     break;
                 }
+                case sf::Keyboard::S:{ // S
+                    if( this -> game_window_states.erase( "Scores" ) > 0 ){
+                        this -> game_window_states.insert( { "Stats", std::make_shared<state::StatsState>( state::StatsState( this ) ) } );
+                    }
+                    else{
+                        this -> game_window_states.erase( "Stats" );
+                        this -> game_window_states.insert( { "Scores", std::make_shared<state::ScoresState>( state::ScoresState( this ) ) } );
+                    }
+                    break;
+                }
                 default:
                     break;
             }
@@ -235,70 +340,22 @@ namespace snake::window{
     }
 
     //====================================================
-    //     processInputFile
+    //     openScoreStore
     //====================================================
     /**
-     * @brief Method used to process and input file containing rows with two elements. Finally gets one of the two elements of a row.
+     * @brief Method used to open the score and statistics stores. The first time, the scores of the text file written by older versions are imported.
      * 
-     * @param input_stream The considered input stream.
-     * @param row_n The number of the file row.
-     * @param pos The number of the word of the file row.
      */
-    std::string GameWindow::processInputFile( std::ifstream input_stream, int16_t row_n, int16_t pos ){
-
-        // Clear stuff from previous iterations
-        this -> lines.clear();
-        this -> words.str( "" );
-        this -> words.clear();
-
-        // Read input file
-        while( std::getline( input_stream, this -> input ) ){
-            this -> lines.push_back( this -> input );
+    void GameWindow::openScoreStore(){
+        this -> stats_store.open( this -> stats_file_path );
+        const auto text_score_file_path = this -> score_file_path.parent_path() / "snake-game_score.txt";
+        const bool import_text_scores = ! std::filesystem::exists( this -> score_file_path ) && std::filesystem::exists( text_score_file_path );
+
+        this -> score_store.open( this -> score_file_path );
+        if( import_text_scores ){
+            std::ifstream text_score_file( text_score_file_path );
+            this -> score_store.append( core::readScores( text_score_file ) );
         }
-        input_stream.close();
-
-        // Get strings from the input file
-        this -> words.str( this -> lines[ row_n ] );
-        this -> words >> this -> strings[0] >> this -> strings[1];
-
-        return strings[ pos ];
-    }
-
-    //====================================================
-    //     getScoresContainer
-    //====================================================
-    /**
-     * @brief Method used to get scores container.
-     * 
-     */
-    std::vector<uint64_t> GameWindow::getScoresContainer() const {
-
-        // Read scores from file
-        std::ifstream score_file( this -> score_file_path );
-        if( ! score_file ){
-            std::ofstream default_settings( this -> score_file_path );
-            default_settings.close();
-        }
-        std::string score_line;
-        std::vector<std::string> lines;
-        while( std::getline( score_file, score_line ) ){
-            lines.push_back( score_line );
-        }
-
-        // Compute best score
-        std::vector <uint64_t> scores_container;
-        std::string player_name;
-        uint64_t player_score;
-        for( const auto& line: lines ){
-            std::stringstream words( line );
-            words >> player_score >> player_name;
-            scores_container.push_back( static_cast<uint64_t>( player_score ) );
-        }
-
-        // Close stream
-        score_file.close();
-
-        return scores_container;
     }
 
     //====================================================
@@ -314,27 +371,110 @@ namespace snake::window{
         #ifdef _WIN32
             this -> game_directory_oss << "C:\\Users\\" << this -> username << "\\snake-game_files";
             this -> options_file_oss << "C:\\Users\\" << this -> username << "\\snake-game_files\\snake-game_options.txt";
-            this -> score_file_oss << "C:\\Users\\" << this -> username << "\\snake-game_files\\snake-game_score.txt";
+            this -> score_file_oss << "C:\\Users\\" << this -> username << "\\snake-game_files\\snake-game_scores.bin";
+            this -> replay_directory_oss << "C:\\Users\\" << this -> username << "\\snake-game_files\\replays";
+            this -> stats_file_oss << "C:\\Users\\" << this -> username << "\\snake-game_files\\snake-game_stats.bin";
         #else
             this -> game_directory_oss << "/home/" << this -> username << "/snake-game_files";
             this -> options_file_oss << "/home/" << this -> username << "/snake-game_files/snake-game_options.txt";
-            this -> score_file_oss << "/home/" << this -> username << "/snake-game_files/snake-game_score.txt";
+            this -> score_file_oss << "/home/" << this -> username << "/snake-game_files/snake-game_scores.bin";
+            this -> replay_directory_oss << "/home/" << this -> username << "/snake-game_files/replays";
+            this -> stats_file_oss << "/home/" << this -> username << "/snake-game_files/snake-game_stats.bin";
         #endif
         
         // Create dirs
         std::filesystem::create_directory( game_directory_oss.str() );
+        std::filesystem::create_directory( replay_directory_oss.str() );
 
         // Create file names
         this -> options_file_path = options_file_oss.str();
         this -> score_file_path = score_file_oss.str();
+        this -> replay_directory_path = replay_directory_oss.str();
+        this -> stats_file_path = stats_file_oss.str();
+
+        // Each game gets its own replay, after the ones already saved
+        this -> next_replay = core::nextReplayIndex( this -> replay_directory_path );
 
         // Fill options file with default values
         if( ! std::ifstream( options_file_path ) ){
-            std::ofstream default_settings( options_file_path );
-            default_settings << "Player: Unknown\n"
-                             << "SpeedPlus: 25\n"
-                             << "Background: default\n";
-            default_settings.close();
+            core::Options().save( options_file_path );
+        }
+
+        // Read the options once, the states use the parsed ones
+        std::ifstream options_file( options_file_path );
+        this -> options = core::Options::parse( options_file );
+    }
+
+    //====================================================
+    //     loadAssets
+    //====================================================
+    /**
+     * @brief Method used to load the textures, fonts and sounds used by the game states. Files are decoded in parallel by the asset loader, while this thread uploads them and draws a progress bar. A background chosen in the options is still loaded when a game starts.
+     * 
+     */
+    void GameWindow::loadAssets(){
+        SNAKE_TRACE_SCOPE( "GameWindow::loadAssets" );
+        utility::AssetLoader asset_loader(
+            {
+                "img/images/logo.png",
+                "img/images/menu_background.jpg",
+                "img/images/scores_title.png",
+                "img/images/settings_logo.png",
+                "img/images/snake_branch.png",
+                "img/images/title_game_background.jpg",
+                "img/images/game_background.jpg",
+                "img/textures/best_score.png",
+                "img/textures/bronze_icon.png",
+                "img/textures/food.png",
+                "img/textures/gold_icon.png",
+                "img/textures/player_icon.png",
+                "img/textures/silver_icon.png",
+                "img/textures/snake_head.png"
+            },
+            {
+                "fonts/source-sans-pro/SourceSansPro-Semibold.otf"
+            },
+            {
+                "sounds/effects/button_click.wav",
+                "sounds/effects/button_switch.wav",
+                "sounds/effects/delete_text.wav",
+                "sounds/effects/pause_window.wav",
+                "sounds/effects/snake_eat.wav",
+                "sounds/effects/snake_looses.wav",
+                "sounds/effects/write_text.wav"
+            }
+        );
+
+        // Progress bar
+        const sf::Vector2f bar_size( this -> getSize().x * 0.4f, this -> getSize().y * 0.02f );
+        const sf::Vector2f bar_position( ( this -> getSize().x - bar_size.x ) * 0.5f, ( this -> getSize().y - bar_size.y ) * 0.5f );
+        sf::RectangleShape bar_frame( bar_size );
+        bar_frame.setPosition( bar_position );
+        bar_frame.setFillColor( sf::Color::Transparent );
+        bar_frame.setOutlineColor( sf::Color::White );
+        bar_frame.setOutlineThickness( 2.f );
+        sf::RectangleShape bar_fill;
+        bar_fill.setPosition( bar_position );
+        bar_fill.setFillColor( sf::Color::Green );
+
+        // Upload what is ready, then draw a frame, until everything is cached
+        while( this -> isOpen() && ! asset_loader.upload( this -> upload_budget ) ){
+            while( this -> pollEvent( this -> game_event ) ){
+                if( this -> game_event.type == sf::Event::Closed ){
+                    this -> close();
+                }
+            }
+
+            bar_fill.setSize( sf::Vector2f( bar_size.x * asset_loader.progress(), bar_size.y ) );
+            this -> clear( sf::Color::Black );
+            this -> draw( bar_frame );
+            this -> draw( bar_fill );
+            this -> display();
+        }
+
+        // The overlay font is cached now
+        if( this -> isOpen() ){
+            this -> performance_overlay.setFont( utility::Resources::font( "fonts/source-sans-pro/SourceSansPro-Semibold.otf" ) );
         }
     }
 
@@ -348,7 +488,6 @@ namespace snake::window{
     void GameWindow::loadSounds(){
 
         // Open pause window
-        this -> window_sound_1.loadFromFile( "sounds/effects/pause_window.wav" );
-        this -> open_pause_window_sound.setBuffer( this -> window_sound_1 );
+        this -> open_pause_window_sound.setBuffer( utility::Resources::soundBuffer( "sounds/effects/pause_window.wav" ) );
     }
 }
\ No newline at end of file
@@ -23,12 +23,16 @@
 // Utility
 #include <utility/gui.hpp>
 
+// Core
+#include <core/trace.hpp>
+
 // SFML
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/VideoMode.hpp>
 #include <SFML/Window/WindowStyle.hpp>
 #include <SFML/Window/Keyboard.hpp>
+#include <SFML/Window/Mouse.hpp>
 
 // STD
 #include <memory>
@@ -64,6 +68,8 @@ namespace snake::window{
             ) 
         );
 
+        this -> mouse_position = sf::Mouse::getPosition( *this );
+
         // Push the Pause state
         if( status == "Pause" ){
             this -> pause_window_states.insert( { status, std::make_shared<state::PauseState>( state::PauseState( this ) ) } );
@@ -75,12 +81,25 @@ namespace snake::window{
     
         // Running the window
         while( this -> isOpen() ){
+            SNAKE_TRACE_SCOPE( "PauseWindow::frame" );
+
+            // Static states already on screen sleep until something happens
+            const auto shown_state = this -> pause_window_states.begin() -> second;
+            if( shown_state -> isStatic() && shown_state.get() == this -> drawn_state ){
+                SNAKE_TRACE_SCOPE( "PauseWindow::idle" );
+                sf::Event pause_event;
+                if( this -> waitStateEvent( pause_event, *shown_state ) ){
+                    processEvent( pause_event );
+                }
+            }
 
             // Run the window
             runWindow();
 
             // Draw the first element of the states map
-            this -> pause_window_states.begin() -> second -> drawState();
+            const auto current_state = this -> pause_window_states.begin() -> second;
+            current_state -> drawState();
+            this -> drawn_state = current_state.get();
         }
     }
     
@@ -96,24 +115,41 @@ namespace snake::window{
         // Check events of the main window
         sf::Event pause_event;
         while( this -> pollEvent( pause_event ) ){
+            processEvent( pause_event );
+        }
+    }
+
+    //====================================================
+    //     processEvent
+    //====================================================
+    /**
+     * @brief Method used to handle an event of the pause window.
+     * 
+     * @param event The event to be handled.
+     */
+    void PauseWindow::processEvent( const sf::Event& event ){
+    
+        // Handling different events
+        switch( event.type ){
         
-            // Handling different events
-            switch( pause_event.type ){
-            
-                // Window closing
-                case sf::Event::Closed:
-                    eventClosed();
-                    break;
-
-                // Key pressed in window
-                case sf::Event::KeyPressed:
-                    eventKeyPressed( pause_event );
-                    break;
-
-                // Default cases
-                default:
-                    break;
-            }
+            // Window closing
+            case sf::Event::Closed:
+                eventClosed();
+                break;
+
+            // Key pressed in window
+            case sf::Event::KeyPressed:
+                eventKeyPressed( event );
+                break;
+
+            // Mouse moved in window, used by widgets hover state
+            case sf::Event::MouseMoved:
+                this -> mouse_position = sf::Vector2i( event.mouseMove.x, event.mouseMove.y );
+                break;
+
+            // Default cases
+            default:
+                break;
         }
     }
 
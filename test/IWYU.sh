@@ -2,6 +2,27 @@
 
 # Variables
 declare -a source_files=(
+  "core/asset_archive.cpp"
+  "core/batch.cpp"
+  "core/board.cpp"
+  "core/bot.cpp"
+  "core/snake.cpp"
+  "core/food.cpp"
+  "core/frame_profile.cpp"
+  "core/game.cpp"
+  "core/game_files.cpp"
+  "core/input_queue.cpp"
+  "core/io_worker.cpp"
+  "core/occupancy.cpp"
+  "core/options.cpp"
+  "core/random.cpp"
+  "core/replay.cpp"
+  "core/score_store.cpp"
+  "core/snapshot.cpp"
+  "core/stats_store.cpp"
+  "core/thread_pool.cpp"
+  "core/timestep.cpp"
+  "core/trace.cpp"
   "entities/entity.cpp"
   "entities/food.cpp"
   "entities/snake.cpp"
@@ -12,7 +33,11 @@ declare -a source_files=(
   "states/options_state.cpp"
   "states/pause_state.cpp"
   "states/scores_state.cpp"
+  "states/stats_state.cpp"
+  "utility/asset_loader.cpp"
   "utility/gui.cpp"
+  "utility/performance_overlay.cpp"
+  "utility/resources.cpp"
   "widgets/button.cpp"
   "widgets/widget.cpp"
   "widgets/textbox.cpp"
@@ -1,11 +1,11 @@
 #!/bin/bash
 
 # Unit tests
-#echo "======================================================"
-#echo "     UNIT TESTS"
-#echo "======================================================"
-#echo ""
-# Empty for the moment...
+echo "======================================================"
+echo "     UNIT TESTS"
+echo "======================================================"
+echo ""
+ctest --test-dir ./build --output-on-failure
 
 # Memory tests
 echo ""
@@ -0,0 +1,93 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file food.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/board.hpp>
+#include <core/food.hpp>
+#include <core/occupancy.hpp>
+#include <core/random.hpp>
+
+// STD
+#include <cstdint>
+#include <vector>
+
+using namespace snake::core;
+
+//====================================================
+//     freeCellsOnly
+//====================================================
+/**
+ * @brief Test that the food always spawns on a free cell, and reaches every free cell.
+ *
+ */
+static void freeCellsOnly(){
+    const Board board( 6, 5 );
+    Occupancy occupancy( board );
+    for( uint32_t i = 0; i < board.size(); i += 2 ){
+        occupancy.set( board.cell( i ) );
+    }
+    Random random( 11 );
+    Food food( occupancy, random );
+    std::vector<uint32_t> hits( board.size(), 0 );
+    for( uint32_t i = 0; i < 3000; i++ ){
+        SNAKE_CHECK( food.respawn( occupancy, random ) );
+        SNAKE_CHECK( ! occupancy.test( food.position ) );
+        hits[ board.index( food.position ) ]++;
+    }
+
+    // Each of the 15 free cells is expected 200 times
+    for( uint32_t i = 0; i < board.size(); i++ ){
+        if( i % 2 == 0 ){
+            SNAKE_CHECK( hits[ i ] == 0 );
+        }
+        else{
+            SNAKE_CHECK( hits[ i ] > 120 && hits[ i ] < 280 );
+        }
+    }
+}
+
+//====================================================
+//     lastFreeCell
+//====================================================
+/**
+ * @brief Test that the food spawns on the only free cell, and that it cannot spawn on a full board.
+ *
+ */
+static void lastFreeCell(){
+    const Board board( 4, 4 );
+    Occupancy occupancy( board );
+    for( uint32_t i = 0; i < board.size(); i++ ){
+        occupancy.set( board.cell( i ) );
+    }
+    occupancy.reset( board.cell( 9 ) );
+    Random random( 5 );
+    Food food( occupancy, random );
+    SNAKE_CHECK( food.position == board.cell( 9 ) );
+
+    occupancy.set( board.cell( 9 ) );
+    SNAKE_CHECK( ! food.respawn( occupancy, random ) );
+    SNAKE_CHECK( food.position == board.cell( 9 ) );
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    freeCellsOnly();
+    lastFreeCell();
+    return snake::test::result();
+}
@@ -0,0 +1,129 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file game.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/board.hpp>
+#include <core/bot.hpp>
+#include <core/game.hpp>
+#include <core/types.hpp>
+
+// STD
+#include <cstdint>
+
+using namespace snake::core;
+
+//====================================================
+//     playGreedy
+//====================================================
+/**
+ * @brief Function used to play a game with the greedy bot until it ends or a number of ticks has passed.
+ *
+ * @param game The game.
+ * @param max_ticks The maximum number of ticks.
+ */
+static void playGreedy( Game& game, uint64_t max_ticks ){
+    while( game.alive && game.ticks < max_ticks ){
+        game.step( greedyInput( game ) );
+    }
+}
+
+//====================================================
+//     startInsideBoard
+//====================================================
+/**
+ * @brief Test that the starting snake and food are inside the board, down to the smallest board.
+ *
+ */
+static void startInsideBoard(){
+    for( const int32_t size: { Board::min_size, 5, 20 } ){
+        const Game game( Board( size, size ), 1 );
+        for( uint32_t i = 0; i < game.snake.length(); i++ ){
+            SNAKE_CHECK( game.board.contains( game.snake.cell( i ) ) );
+        }
+        SNAKE_CHECK( game.snake.length() == Game::start_length );
+        SNAKE_CHECK( game.board.contains( game.food.position ) );
+        SNAKE_CHECK( ! game.snake.occupied().test( game.food.position ) );
+    }
+}
+
+//====================================================
+//     diesOnWall
+//====================================================
+/**
+ * @brief Test that a snake going straight dies on the wall, and that a dead game does not move.
+ *
+ */
+static void diesOnWall(){
+    Game game( Board( 20, 20 ), 7 );
+    StepResult result;
+    while( game.alive && game.ticks < 100 ){
+        result = game.step( Input::None );
+    }
+    SNAKE_CHECK( ! game.alive );
+    SNAKE_CHECK( result.died );
+    SNAKE_CHECK( game.snake.head().y == 0 );
+
+    const uint64_t ticks = game.ticks;
+    result = game.step( Input::Left );
+    SNAKE_CHECK( ! result.died && ! result.ate_food );
+    SNAKE_CHECK( game.ticks == ticks );
+}
+
+//====================================================
+//     ignoresReverse
+//====================================================
+/**
+ * @brief Test that turning back onto the body is ignored.
+ *
+ */
+static void ignoresReverse(){
+    Game game( Board( 20, 20 ), 3 );
+    const Cell head = game.snake.head();
+    game.step( Input::Down );
+    SNAKE_CHECK( game.alive );
+    SNAKE_CHECK( game.snake.head() == neighbour( head, Direction::Up ) );
+}
+
+//====================================================
+//     deterministic
+//====================================================
+/**
+ * @brief Test that the same seed and inputs always give the same game.
+ *
+ */
+static void deterministic(){
+    Game first( Board( 16, 12 ), 42 );
+    Game second( Board( 16, 12 ), 42 );
+    playGreedy( first, 5000 );
+    playGreedy( second, 5000 );
+    SNAKE_CHECK( first.ticks == second.ticks );
+    SNAKE_CHECK( first.score == second.score );
+    SNAKE_CHECK( first.score > 0 );
+    SNAKE_CHECK( first.snake.head() == second.snake.head() );
+    SNAKE_CHECK( first.snake.length() == Game::start_length + first.score );
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    startInsideBoard();
+    diesOnWall();
+    ignoresReverse();
+    deterministic();
+    return snake::test::result();
+}
@@ -0,0 +1,127 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file occupancy.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/board.hpp>
+#include <core/occupancy.hpp>
+#include <core/types.hpp>
+
+// STD
+#include <cstdint>
+#include <vector>
+
+using namespace snake::core;
+
+//====================================================
+//     checkFreeCells
+//====================================================
+/**
+ * @brief Function used to check that the free cells are exactly the cells which are not set.
+ *
+ * @param occupancy The occupancy.
+ * @param board The board of the occupancy.
+ */
+static void checkFreeCells( const Occupancy& occupancy, const Board& board ){
+    std::vector<uint32_t> seen( board.size(), 0 );
+    for( uint32_t i = 0; i < occupancy.freeCount(); i++ ){
+        const Cell cell = occupancy.freeCell( i );
+        SNAKE_CHECK( board.contains( cell ) );
+        SNAKE_CHECK( ! occupancy.test( cell ) );
+        seen[ board.index( cell ) ]++;
+    }
+    for( uint32_t i = 0; i < board.size(); i++ ){
+        SNAKE_CHECK( seen[ i ] == ( occupancy.test( board.cell( i ) ) ? 0u : 1u ) );
+    }
+}
+
+//====================================================
+//     border
+//====================================================
+/**
+ * @brief Test that the cells around the board are occupied, so that walls are found by the same test as the body.
+ *
+ */
+static void border(){
+    const Board board( 5, 4 );
+    const Occupancy occupancy( board );
+    for( int32_t x = -1; x <= board.width; x++ ){
+        SNAKE_CHECK( occupancy.test( { x, -1 } ) );
+        SNAKE_CHECK( occupancy.test( { x, board.height } ) );
+    }
+    for( int32_t y = -1; y <= board.height; y++ ){
+        SNAKE_CHECK( occupancy.test( { -1, y } ) );
+        SNAKE_CHECK( occupancy.test( { board.width, y } ) );
+    }
+    SNAKE_CHECK( occupancy.freeCount() == board.size() );
+    checkFreeCells( occupancy, board );
+}
+
+//====================================================
+//     setAndReset
+//====================================================
+/**
+ * @brief Test that setting and resetting cells, twice or in any order, keeps the free cells consistent.
+ *
+ */
+static void setAndReset(){
+    const Board board( 7, 6 );
+    Occupancy occupancy( board );
+    for( uint32_t i = 0; i < board.size(); i += 3 ){
+        occupancy.set( board.cell( i ) );
+        occupancy.set( board.cell( i ) );
+    }
+    SNAKE_CHECK( occupancy.freeCount() == board.size() - ( board.size() + 2 ) / 3 );
+    checkFreeCells( occupancy, board );
+
+    for( uint32_t i = 0; i < board.size(); i += 2 ){
+        occupancy.reset( board.cell( i ) );
+        occupancy.reset( board.cell( i ) );
+    }
+    checkFreeCells( occupancy, board );
+
+    for( uint32_t i = 0; i < board.size(); i++ ){
+        occupancy.set( board.cell( i ) );
+    }
+    SNAKE_CHECK( occupancy.freeCount() == 0 );
+}
+
+//====================================================
+//     outsideBoard
+//====================================================
+/**
+ * @brief Test that cells outside the board are ignored by set and reset, so the border stays blocked.
+ *
+ */
+static void outsideBoard(){
+    const Board board( Board::min_size, Board::min_size );
+    Occupancy occupancy( board );
+    occupancy.set( { 1, board.height } );
+    occupancy.reset( { -1, 2 } );
+    SNAKE_CHECK( occupancy.test( { -1, 2 } ) );
+    SNAKE_CHECK( occupancy.freeCount() == board.size() );
+    checkFreeCells( occupancy, board );
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    border();
+    setAndReset();
+    outsideBoard();
+    return snake::test::result();
+}
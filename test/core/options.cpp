@@ -0,0 +1,123 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file options.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/options.hpp>
+
+// STD
+#include <sstream>
+
+using namespace snake::core;
+
+//====================================================
+//     parseRows
+//====================================================
+/**
+ * @brief Test that rows are matched by key in any order, and that unknown or blank rows are skipped.
+ *
+ */
+static void parseRows(){
+    std::istringstream file( "Seed: 42\n\nTheme: dark\nBackground: grass.png\nSpeedPlus: 30\n  Player: alice bob\n" );
+    const Options options = Options::parse( file );
+    SNAKE_CHECK( options.player == "alice" );
+    SNAKE_CHECK( options.speed == 30 );
+    SNAKE_CHECK( options.background == "grass.png" );
+    SNAKE_CHECK( options.seed && *options.seed == 42 );
+}
+
+//====================================================
+//     invalidValues
+//====================================================
+/**
+ * @brief Test that invalid values keep the defaults.
+ *
+ */
+static void invalidValues(){
+    std::istringstream file( "Player:\nSpeedPlus: -3\nBackground:   \nSeed: 12ab\n" );
+    const Options options = Options::parse( file );
+    const Options defaults;
+    SNAKE_CHECK( options.player == defaults.player );
+    SNAKE_CHECK( options.speed == defaults.speed );
+    SNAKE_CHECK( options.background == defaults.background );
+    SNAKE_CHECK( ! options.seed );
+}
+
+//====================================================
+//     setters
+//====================================================
+/**
+ * @brief Test that the setters reject invalid values and leave the option unchanged.
+ *
+ */
+static void setters(){
+    Options options;
+    SNAKE_CHECK( ! options.setSpeed( "0" ) );
+    SNAKE_CHECK( ! options.setSpeed( "fast" ) );
+    SNAKE_CHECK( ! options.setSpeed( "99999999999" ) );
+    SNAKE_CHECK( options.speed == 25 );
+    SNAKE_CHECK( options.setSpeed( " 40 " ) );
+    SNAKE_CHECK( options.speed == 40 );
+
+    SNAKE_CHECK( ! options.setSeed( "-1" ) );
+    SNAKE_CHECK( ! options.seed );
+    SNAKE_CHECK( options.setSeed( "7" ) );
+    SNAKE_CHECK( options.seed && *options.seed == 7 );
+    SNAKE_CHECK( options.setSeed( "random" ) );
+    SNAKE_CHECK( ! options.seed );
+
+    SNAKE_CHECK( ! options.setPlayer( " \t" ) );
+    SNAKE_CHECK( options.player == "Unknown" );
+}
+
+//====================================================
+//     roundTrip
+//====================================================
+/**
+ * @brief Test that written options are parsed back to the same values.
+ *
+ */
+static void roundTrip(){
+    Options options;
+    options.setPlayer( "carol" );
+    options.setSpeed( "12" );
+    options.setBackground( "sand.png" );
+    options.setSeed( "18446744073709551615" );
+
+    std::stringstream file;
+    options.write( file );
+    const Options parsed = Options::parse( file );
+    SNAKE_CHECK( parsed.player == options.player );
+    SNAKE_CHECK( parsed.speed == options.speed );
+    SNAKE_CHECK( parsed.background == options.background );
+    SNAKE_CHECK( parsed.seed == options.seed );
+
+    options.setSeed( "random" );
+    std::stringstream random_file;
+    options.write( random_file );
+    SNAKE_CHECK( ! Options::parse( random_file ).seed );
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    parseRows();
+    invalidValues();
+    setters();
+    roundTrip();
+    return snake::test::result();
+}
@@ -0,0 +1,99 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file random.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/random.hpp>
+
+// STD
+#include <cstdint>
+#include <vector>
+
+using namespace snake::core;
+
+//====================================================
+//     referenceSequence
+//====================================================
+/**
+ * @brief Test that the engine gives the reference xoshiro256** outputs, seeded by splitmix64, so that replays play the same on every platform.
+ *
+ */
+static void referenceSequence(){
+    Random random( 42 );
+    SNAKE_CHECK( random.next() == 0x15780b2e0c2ec716ull );
+    SNAKE_CHECK( random.next() == 0x6104d9866d113a7eull );
+    SNAKE_CHECK( random.next() == 0xae17533239e499a1ull );
+
+    Random bounded( 42 );
+    for( const uint32_t expected: { 8u, 37u, 68u, 92u, 99u, 76u, 71u, 85u } ){
+        SNAKE_CHECK( bounded.uniform( 100 ) == expected );
+    }
+}
+
+//====================================================
+//     sameSeed
+//====================================================
+/**
+ * @brief Test that the same seed gives the same sequence, and a different seed a different one.
+ *
+ */
+static void sameSeed(){
+    Random first( 2026 ), second( 2026 ), other( 2027 );
+    bool differs = false;
+    for( uint32_t i = 0; i < 1000; i++ ){
+        const uint64_t value = first.next();
+        SNAKE_CHECK( value == second.next() );
+        differs = differs || value != other.next();
+    }
+    SNAKE_CHECK( differs );
+}
+
+//====================================================
+//     uniformBounds
+//====================================================
+/**
+ * @brief Test that bounded numbers stay below the bound and cover it evenly, including bounds which do not divide 2^32.
+ *
+ */
+static void uniformBounds(){
+    Random random( 9 );
+    for( uint32_t i = 0; i < 100; i++ ){
+        SNAKE_CHECK( random.uniform( 1 ) == 0 );
+    }
+
+    constexpr uint32_t bound{ 7 };
+    std::vector<uint32_t> hits( bound, 0 );
+    for( uint32_t i = 0; i < 70000; i++ ){
+        const uint32_t value = random.uniform( bound );
+        SNAKE_CHECK( value < bound );
+        if( value < bound ){
+            hits[ value ]++;
+        }
+    }
+    for( const uint32_t count: hits ){
+        SNAKE_CHECK( count > 9500 && count < 10500 );
+    }
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    referenceSequence();
+    sameSeed();
+    uniformBounds();
+    return snake::test::result();
+}
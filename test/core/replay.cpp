@@ -0,0 +1,119 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file replay.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/board.hpp>
+#include <core/bot.hpp>
+#include <core/game.hpp>
+#include <core/game_files.hpp>
+#include <core/replay.hpp>
+#include <core/types.hpp>
+
+// STD
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace snake::core;
+
+//====================================================
+//     roundTrip
+//====================================================
+/**
+ * @brief Test that a game recorded, saved and loaded again plays back to the same end.
+ *
+ */
+static void roundTrip(){
+    const Board board( 18, 14 );
+    Game game( board, 1234 );
+    Replay recording( board, game.seed );
+    while( game.alive && game.ticks < 5000 ){
+        const Input input = greedyInput( game );
+        recording.record( game.ticks, input );
+        game.step( input );
+    }
+
+    std::stringstream file;
+    recording.save( file );
+    Replay playback = Replay::load( file );
+    SNAKE_CHECK( playback.board.width == board.width && playback.board.height == board.height );
+    SNAKE_CHECK( playback.seed == game.seed );
+    SNAKE_CHECK( playback.size() == recording.size() );
+
+    Game replayed( playback.board, playback.seed );
+    while( replayed.alive && replayed.ticks < 5000 ){
+        replayed.step( playback.next( replayed.ticks ) );
+    }
+    SNAKE_CHECK( replayed.ticks == game.ticks );
+    SNAKE_CHECK( replayed.score == game.score );
+    SNAKE_CHECK( replayed.snake.head() == game.snake.head() );
+}
+
+//====================================================
+//     invalidFile
+//====================================================
+/**
+ * @brief Test that a file which is not a replay is rejected.
+ *
+ */
+static void invalidFile(){
+    std::stringstream file( "SNKS not a replay" );
+    bool rejected = false;
+    try{
+        Replay::load( file );
+    }
+    catch( const std::exception& ){
+        rejected = true;
+    }
+    SNAKE_CHECK( rejected );
+}
+
+//====================================================
+//     replayFiles
+//====================================================
+/**
+ * @brief Test that each game gets a new replay file, after the highest one in the directory.
+ *
+ */
+static void replayFiles(){
+    const std::filesystem::path directory = "replays";
+    std::filesystem::remove_all( directory );
+    SNAKE_CHECK( nextReplayIndex( directory ) == 1 );
+
+    std::filesystem::create_directory( directory );
+    SNAKE_CHECK( nextReplayIndex( directory ) == 1 );
+    SNAKE_CHECK( replayPath( directory, 7 ) == directory / "replay_000007.bin" );
+    for( const uint64_t index: { 3, 12 } ){
+        std::ofstream( replayPath( directory, index ) ) << "replay";
+    }
+    std::ofstream( directory / "replay_x.bin" ) << "other";
+    std::ofstream( directory / "notes.txt" ) << "other";
+    SNAKE_CHECK( nextReplayIndex( directory ) == 13 );
+    std::filesystem::remove_all( directory );
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    roundTrip();
+    invalidFile();
+    replayFiles();
+    return snake::test::result();
+}
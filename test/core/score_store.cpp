@@ -0,0 +1,180 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file score_store.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/score_store.hpp>
+#include <core/types.hpp>
+
+// STD
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace snake::core;
+
+//====================================================
+//     Constants
+//====================================================
+static const std::filesystem::path store_path{ "scores.bin" };
+static const std::filesystem::path corrupt_path{ "scores.bin.corrupt" };
+
+//====================================================
+//     reset
+//====================================================
+/**
+ * @brief Function used to remove the files left by a previous test.
+ *
+ */
+static void reset(){
+    std::filesystem::remove( store_path );
+    std::filesystem::remove( corrupt_path );
+}
+
+//====================================================
+//     topScores
+//====================================================
+/**
+ * @brief Test that the store keeps the best scores in order, and reads them back when opened again.
+ *
+ */
+static void topScores(){
+    reset();
+    ScoreStore store;
+    SNAKE_CHECK( store.open( store_path ) );
+    SNAKE_CHECK( store.size() == 0 && store.top().empty() );
+
+    std::vector<ScoreEntry> entries;
+    for( uint64_t i = 0; i < 25; i++ ){
+        entries.push_back( { ( i * 7 ) % 25, "player" + std::to_string( i ) } );
+    }
+    SNAKE_CHECK( store.append( entries ) );
+    SNAKE_CHECK( store.append( ScoreEntry{ 30, "alice" } ) );
+
+    ScoreStore reopened;
+    SNAKE_CHECK( reopened.open( store_path ) );
+    SNAKE_CHECK( reopened.size() == 26 );
+    SNAKE_CHECK( reopened.best() == 30 );
+    SNAKE_CHECK( reopened.top().size() == ScoreStore::top_capacity );
+    SNAKE_CHECK( reopened.top().front().player == "alice" );
+    for( size_t i = 1; i < reopened.top().size(); i++ ){
+        SNAKE_CHECK( reopened.top()[ i ].score == 25 - i );
+    }
+    reset();
+}
+
+//====================================================
+//     garbageFile
+//====================================================
+/**
+ * @brief Test that a file which is not a store is moved aside, and that a new store is started in its place.
+ *
+ */
+static void garbageFile(){
+    reset();
+    std::ofstream( store_path ) << std::string( 2000, 'x' );
+
+    ScoreStore store;
+    SNAKE_CHECK( store.open( store_path ) );
+    SNAKE_CHECK( std::filesystem::exists( corrupt_path ) );
+    SNAKE_CHECK( std::filesystem::file_size( corrupt_path ) == 2000 );
+    SNAKE_CHECK( store.size() == 0 );
+    SNAKE_CHECK( store.append( ScoreEntry{ 5, "bob" } ) );
+
+    ScoreStore reopened;
+    SNAKE_CHECK( reopened.open( store_path ) );
+    SNAKE_CHECK( reopened.size() == 1 && reopened.best() == 5 );
+    reset();
+}
+
+//====================================================
+//     truncatedHeader
+//====================================================
+/**
+ * @brief Test that a store cut within its header is moved aside.
+ *
+ */
+static void truncatedHeader(){
+    reset();
+    {
+        ScoreStore store;
+        store.open( store_path );
+        store.append( ScoreEntry{ 9, "carol" } );
+    }
+    std::filesystem::resize_file( store_path, 20 );
+
+    ScoreStore store;
+    SNAKE_CHECK( store.open( store_path ) );
+    SNAKE_CHECK( std::filesystem::exists( corrupt_path ) );
+    SNAKE_CHECK( store.size() == 0 );
+    SNAKE_CHECK( store.append( ScoreEntry{ 3, "dave" } ) );
+    SNAKE_CHECK( store.best() == 3 );
+    reset();
+}
+
+//====================================================
+//     damagedHeader
+//====================================================
+/**
+ * @brief Test that a header with an invalid number of top scores, or records cut by a crash, are rebuilt from the records.
+ *
+ */
+static void damagedHeader(){
+    reset();
+    {
+        ScoreStore store;
+        store.open( store_path );
+        store.append( { { 4, "erin" }, { 11, "frank" }, { 7, "grace" } } );
+    }
+    {
+        std::fstream file( store_path, std::ios::in | std::ios::out | std::ios::binary );
+        file.seekp( 24 );
+        file << std::string( 8, '\xFF' );
+    }
+
+    ScoreStore store;
+    SNAKE_CHECK( store.open( store_path ) );
+    SNAKE_CHECK( ! std::filesystem::exists( corrupt_path ) );
+    SNAKE_CHECK( store.size() == 3 );
+    SNAKE_CHECK( store.best() == 11 );
+    SNAKE_CHECK( store.top().size() == 3 && store.top().front().player == "frank" );
+
+    std::filesystem::resize_file( store_path, std::filesystem::file_size( store_path ) - 10 );
+    ScoreStore truncated;
+    SNAKE_CHECK( truncated.open( store_path ) );
+    SNAKE_CHECK( truncated.size() == 2 );
+    SNAKE_CHECK( truncated.best() == 11 );
+    SNAKE_CHECK( truncated.append( ScoreEntry{ 1, "heidi" } ) );
+
+    ScoreStore reopened;
+    SNAKE_CHECK( reopened.open( store_path ) );
+    SNAKE_CHECK( reopened.size() == 3 );
+    SNAKE_CHECK( reopened.top().back().player == "heidi" );
+    reset();
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    topScores();
+    garbageFile();
+    truncatedHeader();
+    damagedHeader();
+    return snake::test::result();
+}
@@ -0,0 +1,152 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file snake.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/board.hpp>
+#include <core/snake.hpp>
+#include <core/types.hpp>
+
+// STD
+#include <cstdint>
+#include <cstdlib>
+
+using namespace snake::core;
+
+//====================================================
+//     checkBody
+//====================================================
+/**
+ * @brief Function used to check that the body is a chain of adjacent cells, all of them marked as occupied.
+ *
+ * @param snake The snake.
+ * @param board The board of the snake.
+ */
+static void checkBody( const Snake& snake, const Board& board ){
+    for( uint32_t i = 0; i < snake.length(); i++ ){
+        SNAKE_CHECK( snake.occupied().test( snake.cell( i ) ) );
+        if( i > 0 ){
+            const Cell& previous = snake.cell( i - 1 );
+            const Cell& current = snake.cell( i );
+            SNAKE_CHECK( std::abs( previous.x - current.x ) + std::abs( previous.y - current.y ) == 1 );
+        }
+    }
+    SNAKE_CHECK( snake.occupied().freeCount() == board.size() - snake.length() );
+    SNAKE_CHECK( snake.cell( snake.length() - 1 ) == snake.tail() );
+}
+
+//====================================================
+//     construction
+//====================================================
+/**
+ * @brief Test that the body is laid behind the head.
+ *
+ */
+static void construction(){
+    const Board board( 10, 10 );
+    const Snake snake( board, { 5, 5 }, Direction::Left, 3 );
+    SNAKE_CHECK( snake.head() == Cell( { 5, 5 } ) );
+    SNAKE_CHECK( snake.tail() == Cell( { 7, 5 } ) );
+    SNAKE_CHECK( snake.length() == 3 );
+    SNAKE_CHECK( snake.capacity() == board.size() );
+    SNAKE_CHECK( snake.nextHead() == Cell( { 4, 5 } ) );
+    checkBody( snake, board );
+}
+
+//====================================================
+//     ringWraps
+//====================================================
+/**
+ * @brief Test that the body stays consistent while the ring buffer wraps around many times, growing and moving around the border.
+ *
+ */
+static void ringWraps(){
+    const Board board( 4, 4 );
+    Snake snake( board, { 0, 2 }, Direction::Up, 2 );
+    Cell head{ 0, 2 };
+    for( uint64_t move = 0; move < 200; move++ ){
+        if( head.y == 0 && head.x < 3 ){
+            snake.turn( Direction::Right );
+        }
+        else if( head.x == 3 && head.y < 3 ){
+            snake.turn( Direction::Down );
+        }
+        else if( head.y == 3 && head.x > 0 ){
+            snake.turn( Direction::Left );
+        }
+        else{
+            snake.turn( Direction::Up );
+        }
+        const Cell tail = snake.tail();
+        const bool grow = move % 20 == 0 && snake.length() < 10;
+        snake.advance( grow );
+        head = snake.head();
+        SNAKE_CHECK( snake.previous_tail == tail );
+        SNAKE_CHECK( grow || ! snake.occupied().test( tail ) );
+        checkBody( snake, board );
+    }
+    SNAKE_CHECK( snake.moves() == 200 );
+    SNAKE_CHECK( snake.length() == 10 );
+}
+
+//====================================================
+//     turns
+//====================================================
+/**
+ * @brief Test that a turn onto the body is ignored, even after another turn in the same tick, and that collisions ignore the moving tail only when asked.
+ *
+ */
+static void turns(){
+    const Board board( 10, 10 );
+    Snake snake( board, { 5, 5 }, Direction::Up, 4 );
+    snake.turn( Direction::Down );
+    SNAKE_CHECK( snake.direction == Direction::Up );
+    snake.turn( Direction::Left );
+    snake.turn( Direction::Down );
+    SNAKE_CHECK( snake.direction == Direction::Left );
+    snake.advance( false );
+    SNAKE_CHECK( snake.head() == Cell( { 4, 5 } ) );
+    SNAKE_CHECK( snake.last_direction == Direction::Left );
+
+    SNAKE_CHECK( snake.collides( snake.tail(), false ) );
+    SNAKE_CHECK( ! snake.collides( snake.tail(), true ) );
+    SNAKE_CHECK( snake.collides( Cell( { -1, 0 } ), true ) );
+    SNAKE_CHECK( snake.collides( Cell( { 0, board.height } ), true ) );
+}
+
+//====================================================
+//     growthLimit
+//====================================================
+/**
+ * @brief Test that the snake does not grow beyond the board.
+ *
+ */
+static void growthLimit(){
+    const Board board( 4, 4 );
+    Snake snake( board, { 0, 0 }, Direction::Right, 100 );
+    SNAKE_CHECK( snake.length() == snake.capacity() );
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    construction();
+    ringWraps();
+    turns();
+    growthLimit();
+    return snake::test::result();
+}
@@ -0,0 +1,162 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file stats_store.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/game_files.hpp>
+#include <core/score_store.hpp>
+#include <core/stats_store.hpp>
+#include <core/types.hpp>
+
+// STD
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace snake::core;
+
+//====================================================
+//     Constants
+//====================================================
+static const std::filesystem::path stats_path{ "stats.bin" };
+static const std::filesystem::path scores_path{ "stats_scores.bin" };
+
+//====================================================
+//     reset
+//====================================================
+/**
+ * @brief Function used to remove the files left by a previous test.
+ *
+ */
+static void reset(){
+    for( const auto& path: { stats_path, scores_path } ){
+        std::filesystem::path corrupt_path = path;
+        corrupt_path += ".corrupt";
+        std::filesystem::remove( path );
+        std::filesystem::remove( corrupt_path );
+    }
+}
+
+//====================================================
+//     playerStats
+//====================================================
+/**
+ * @brief Test that the statistics of each player are summed, and read back when the store is opened again.
+ *
+ */
+static void playerStats(){
+    reset();
+    StatsStore store;
+    SNAKE_CHECK( store.open( stats_path ) );
+    SNAKE_CHECK( store.add( { "alice", 10, 3, 40 } ) );
+    SNAKE_CHECK( store.add( { "alice", 20, 5, 60 } ) );
+    SNAKE_CHECK( store.add( { "bob", 7, 2, 15 } ) );
+
+    StatsStore reopened;
+    SNAKE_CHECK( reopened.open( stats_path ) );
+    SNAKE_CHECK( reopened.players().size() == 2 );
+    const PlayerStats* alice = reopened.find( "alice" );
+    SNAKE_CHECK( alice != nullptr );
+    if( alice ){
+        SNAKE_CHECK( alice -> games == 2 );
+        SNAKE_CHECK( alice -> best == 20 );
+        SNAKE_CHECK( alice -> food == 8 );
+        SNAKE_CHECK( alice -> play_time == 100 );
+        SNAKE_CHECK( alice -> mean() == 15.0 );
+    }
+    SNAKE_CHECK( reopened.find( "carol" ) == nullptr );
+    reset();
+}
+
+//====================================================
+//     invalidFile
+//====================================================
+/**
+ * @brief Test that a file which is not a store is moved aside, and that a new store is started in its place.
+ *
+ */
+static void invalidFile(){
+    reset();
+    std::ofstream( stats_path ) << "not a stats file";
+
+    StatsStore store;
+    SNAKE_CHECK( store.open( stats_path ) );
+    SNAKE_CHECK( std::filesystem::exists( std::filesystem::path( "stats.bin.corrupt" ) ) );
+    SNAKE_CHECK( store.players().empty() );
+    SNAKE_CHECK( store.add( { "dave", 4, 1, 10 } ) );
+
+    StatsStore reopened;
+    SNAKE_CHECK( reopened.open( stats_path ) );
+    SNAKE_CHECK( reopened.find( "dave" ) != nullptr );
+    reset();
+}
+
+//====================================================
+//     utf8Truncation
+//====================================================
+/**
+ * @brief Test that texts are cut on code point boundaries.
+ *
+ */
+static void utf8Truncation(){
+    SNAKE_CHECK( truncateUtf8( "snake", 10 ) == "snake" );
+    SNAKE_CHECK( truncateUtf8( "snake", 3 ) == "sna" );
+    SNAKE_CHECK( truncateUtf8( "a\xC3\xA8", 2 ) == "a" );
+    SNAKE_CHECK( truncateUtf8( "a\xC3\xA8", 3 ) == "a\xC3\xA8" );
+    SNAKE_CHECK( truncateUtf8( "\xE2\x82\xAC\xE2\x82\xAC", 5 ) == "\xE2\x82\xAC" );
+    SNAKE_CHECK( truncateUtf8( "\xF0\x9F\x90\x8D", 3 ).empty() );
+}
+
+//====================================================
+//     longNames
+//====================================================
+/**
+ * @brief Test that names longer than the record are cut without splitting a character, in both stores.
+ *
+ */
+static void longNames(){
+    reset();
+    std::string name( StatsStore::player_size - 1, 'n' );
+    name += "\xC3\xA8";
+    const std::string stored = name.substr( 0, StatsStore::player_size - 1 );
+
+    StatsStore stats;
+    stats.open( stats_path );
+    SNAKE_CHECK( stats.add( { name, 1, 1, 1 } ) );
+    StatsStore reopened_stats;
+    reopened_stats.open( stats_path );
+    SNAKE_CHECK( reopened_stats.find( name ) != nullptr );
+    SNAKE_CHECK( reopened_stats.players().count( stored ) == 1 );
+
+    ScoreStore scores;
+    scores.open( scores_path );
+    SNAKE_CHECK( scores.append( ScoreEntry{ 2, name } ) );
+    ScoreStore reopened_scores;
+    reopened_scores.open( scores_path );
+    SNAKE_CHECK( reopened_scores.top().size() == 1 && reopened_scores.top().front().player == stored );
+    reset();
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    playerStats();
+    invalidFile();
+    utf8Truncation();
+    longNames();
+    return snake::test::result();
+}
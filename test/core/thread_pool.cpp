@@ -0,0 +1,98 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file thread_pool.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Test
+#include <test.hpp>
+
+// Core
+#include <core/batch.hpp>
+#include <core/board.hpp>
+#include <core/thread_pool.hpp>
+
+// STD
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+using namespace snake::core;
+
+//====================================================
+//     everyTaskOnce
+//====================================================
+/**
+ * @brief Test that each task of several batches, posted to the same workers, runs exactly once.
+ *
+ */
+static void everyTaskOnce(){
+    WorkStealingPool pool( 4 );
+    SNAKE_CHECK( pool.size() == 4 );
+    for( const uint64_t tasks: { 1000, 0, 1, 37 } ){
+        std::vector<std::atomic<uint32_t>> runs( tasks );
+        std::atomic<bool> valid_worker{ true };
+        pool.run( tasks, [ & ]( uint32_t worker, uint64_t task ){
+            valid_worker = valid_worker && worker < pool.size();
+            runs[ task ]++;
+        } );
+        SNAKE_CHECK( valid_worker );
+        for( const auto& count: runs ){
+            SNAKE_CHECK( count == 1 );
+        }
+    }
+}
+
+//====================================================
+//     postAndWait
+//====================================================
+/**
+ * @brief Test that a posted batch runs without the caller, and is over once waited for.
+ *
+ */
+static void postAndWait(){
+    std::atomic<uint64_t> sum{ 0 };
+    {
+        WorkStealingPool pool( 3 );
+        pool.post( 100, [ & ]( uint32_t, uint64_t task ){ sum += task; } );
+        pool.wait();
+        SNAKE_CHECK( sum == 4950 );
+        pool.post( 100, [ & ]( uint32_t, uint64_t task ){ sum += task; } );
+    }
+    SNAKE_CHECK( sum == 9900 );
+}
+
+//====================================================
+//     batchReproducible
+//====================================================
+/**
+ * @brief Test that a batch of games gives the same results whatever the number of threads.
+ *
+ */
+static void batchReproducible(){
+    const BatchStats single = runBatch( Board( 12, 10 ), 64, 5, 1, 20000 );
+    const BatchStats several = runBatch( Board( 12, 10 ), 64, 5, 4, 20000 );
+    SNAKE_CHECK( single.games == 64 && several.games == 64 );
+    SNAKE_CHECK( single.total_score == several.total_score );
+    SNAKE_CHECK( single.max_score == several.max_score );
+    SNAKE_CHECK( single.total_ticks == several.total_ticks );
+    SNAKE_CHECK( single.wins == several.wins );
+}
+
+//====================================================
+//     main
+//====================================================
+int main(){
+    everyTaskOnce();
+    postAndWait();
+    batchReproducible();
+    return snake::test::result();
+}
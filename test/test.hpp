@@ -0,0 +1,77 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file test.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor directives
+//====================================================
+#pragma once
+#ifndef SNAKE_GAME_TEST
+#define SNAKE_GAME_TEST
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD
+#include <cstdint>
+#include <iostream>
+
+//====================================================
+//     Macros
+//====================================================
+#define SNAKE_CHECK( condition ) snake::test::check( static_cast<bool>( condition ), #condition, __FILE__, __LINE__ )
+
+namespace snake::test{
+
+    //====================================================
+    //     failures
+    //====================================================
+    /**
+     * @brief Number of failed checks of the running test executable.
+     *
+     */
+    inline uint32_t failures{ 0 };
+
+    //====================================================
+    //     check
+    //====================================================
+    /**
+     * @brief Function used to check a condition, reporting it if it does not hold. The following checks are still run.
+     *
+     * @param condition The checked condition.
+     * @param expression The condition, as written in the test.
+     * @param file The test file.
+     * @param line The test line.
+     */
+    inline void check( bool condition, const char* expression, const char* file, uint32_t line ){
+        if( ! condition ){
+            std::cerr << file << ":" << line << ": check failed: " << expression << "\n";
+            failures++;
+        }
+    }
+
+    //====================================================
+    //     result
+    //====================================================
+    /**
+     * @brief Function used to get the exit code of a test executable.
+     *
+     * @return int 0 if every check held, 1 otherwise.
+     */
+    inline int result(){
+        if( failures > 0 ){
+            std::cerr << failures << " checks failed\n";
+            return 1;
+        }
+        return 0;
+    }
+}
+
+#endif
@@ -0,0 +1,127 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file batch.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/board.hpp>
+#include <core/batch.hpp>
+
+// STD
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <string_view>
+#include <system_error>
+
+//====================================================
+//     Constants
+//====================================================
+static constexpr int32_t max_board_size{ 4096 };
+
+//====================================================
+//     printUsage
+//====================================================
+/**
+ * @brief Function used to print the command line options.
+ *
+ * @param program The program name.
+ */
+static void printUsage( const char* program ){
+    std::fprintf( 
+        stderr, "Usage: %s [--games <n>] [--seed <n>] [--max-ticks <n>] [--threads <n>] [--width <%d-%d>] [--height <%d-%d>]\n",
+        program, snake::core::Board::min_size, max_board_size, snake::core::Board::min_size, max_board_size
+    );
+}
+
+//====================================================
+//     parseNumber
+//====================================================
+/**
+ * @brief Function used to read a whole number from a command line value.
+ *
+ * @tparam Number The type of the number.
+ * @param value The command line value.
+ * @param number The number read.
+ * @return true If the whole value is a number which fits the type.
+ * @return false Otherwise.
+ */
+template <typename Number>
+static bool parseNumber( std::string_view value, Number& number ){
+    const auto [ end, error ] = std::from_chars( value.data(), value.data() + value.size(), number );
+    return error == std::errc() && end == value.data() + value.size();
+}
+
+//====================================================
+//     main
+//====================================================
+int main( int argc, char** argv ){
+    using namespace snake::core;
+
+    // Settings
+    uint64_t games{ 10000 };
+    uint64_t seed{ 1 };
+    uint64_t max_ticks{ 100000 };
+    uint32_t threads{ 0 };
+    int32_t width{ 40 };
+    int32_t height{ 30 };
+    for( int i = 1; i < argc; i += 2 ){
+        const std::string_view option{ argv[ i ] };
+        const std::string_view value{ i + 1 < argc ? argv[ i + 1 ] : "" };
+        bool valid = false;
+        if( option == "--games" ){
+            valid = parseNumber( value, games );
+        }
+        else if( option == "--seed" ){
+            valid = parseNumber( value, seed );
+        }
+        else if( option == "--max-ticks" ){
+            valid = parseNumber( value, max_ticks );
+        }
+        else if( option == "--threads" ){
+            valid = parseNumber( value, threads );
+        }
+        else if( option == "--width" ){
+            valid = parseNumber( value, width ) && width >= Board::min_size && width <= max_board_size;
+        }
+        else if( option == "--height" ){
+            valid = parseNumber( value, height ) && height >= Board::min_size && height <= max_board_size;
+        }
+        if( ! valid ){
+            std::fprintf( stderr, "Invalid option %s %s\n", argv[ i ], value.data() );
+            printUsage( argv[ 0 ] );
+            return 1;
+        }
+    }
+
+    // Run the batch
+    BatchStats stats;
+    try{
+        stats = runBatch( Board( width, height ), games, seed, threads, max_ticks );
+    }
+    catch( const std::exception& exception ){
+        std::fprintf( stderr, "%s\n", exception.what() );
+        return 1;
+    }
+
+    // Print results
+    std::printf( "games          %llu\n", static_cast<unsigned long long>( stats.games ) );
+    std::printf( "wins           %llu\n", static_cast<unsigned long long>( stats.wins ) );
+    std::printf( "mean score     %.2f\n", stats.meanScore() );
+    std::printf( "max score      %llu\n", static_cast<unsigned long long>( stats.max_score ) );
+    std::printf( "mean length    %.2f\n", stats.meanLength() );
+    std::printf( "max length     %llu\n", static_cast<unsigned long long>( stats.max_length ) );
+    std::printf( "total ticks    %llu\n", static_cast<unsigned long long>( stats.total_ticks ) );
+    std::printf( "seconds        %.3f\n", stats.seconds );
+    std::printf( "ticks/sec      %.0f\n", stats.ticksPerSecond() );
+}
@@ -0,0 +1,52 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file pack.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-17
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Core
+#include <core/asset_archive.hpp>
+
+// STD
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <vector>
+
+//====================================================
+//     main
+//====================================================
+int main( int argc, char** argv ){
+    using namespace snake::core;
+
+    // Usage: snake-pack <archive> <root> <directory>...
+    if( argc < 4 ){
+        std::fprintf( stderr, "Usage: %s <archive> <root> <directory>...\n", argv[ 0 ] );
+        return 1;
+    }
+    const std::vector<std::filesystem::path> directories( argv + 3, argv + argc );
+
+    // Pack and check the archive
+    try{
+        const uint64_t files = AssetArchive::pack( argv[ 1 ], argv[ 2 ], directories );
+        AssetArchive archive;
+        if( ! archive.open( argv[ 1 ] ) || archive.size() != files ){
+            std::fprintf( stderr, "The written archive is not valid\n" );
+            return 1;
+        }
+        std::printf( "Packed %llu files into %s\n", static_cast<unsigned long long>( files ), argv[ 1 ] );
+    }
+    catch( const std::exception& exception ){
+        std::fprintf( stderr, "%s\n", exception.what() );
+        return 1;
+    }
+}